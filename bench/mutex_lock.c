@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2018-2019 Mutant Industries ltd.
+//
+// Uncontended mutex lock / unlock pair, owner holds a few other mutexes, so that its exit action queue is not empty
+#include <stddef.h>
+#include <stdio.h>
+#include <sys/time.h>
+#include <process.h>
+#include <scheduler.h>
+#include <sync/mutex.h>
+
+#define ITERATIONS      2000000L
+#define HELD_MUTEX_CNT  3
+
+static Process_control_block_t init_process;
+static Context_switch_handle_t context_switch_handle;
+static Mutex_t mutex, held[HELD_MUTEX_CNT];
+
+int main(void) {
+    struct timeval start, end;
+    long i;
+
+    // the same init sequence as kernel_start(), no timing needed
+    running_process = &init_process;
+    scheduler_reinit(&context_switch_handle, true);
+    init_process.create_config.priority = 10;
+    process_create(&init_process);
+    process_schedule(&init_process, 0);
+    running_process = &init_process;
+
+    mutex_register(&mutex);
+
+    for (i = 0; i < HELD_MUTEX_CNT; i++) {
+        mutex_register(&held[i]);
+        mutex_lock(&held[i]);
+    }
+
+    gettimeofday(&start, NULL);
+
+    for (i = 0; i < ITERATIONS; i++) {
+        mutex_lock(&mutex);
+        mutex_unlock(&mutex);
+    }
+
+    gettimeofday(&end, NULL);
+
+    printf("mutex lock / unlock: %.1f ns\n",
+            ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_usec - start.tv_usec) * 1e3) / ITERATIONS);
+
+    return 0;
+}
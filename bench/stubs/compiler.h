@@ -0,0 +1,16 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Host stub of MSP430 driver API - compiler specific attributes
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _BENCH_COMPILER_H_
+#define _BENCH_COMPILER_H_
+
+#define __persistent
+#define __naked
+#define __interrupt
+#define reti
+
+#endif /* _BENCH_COMPILER_H_ */
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2018-2019 Mutant Industries ltd.
+#include <stdbool.h>
+#include <stdint.h>
+#include <driver/disposable.h>
+#include <driver/interrupt.h>
+#include <driver/timer.h>
+#include <driver/vector.h>
+
+
+void interrupt_suspend(void) {}
+void interrupt_restore(void) {}
+void interrupt_enable(void) {}
+
+// -------------------------------------------------------------------------------------
+
+void __do_zerofill(void *pointer, uint16_t size) {
+    while (size--) {
+        ((uint8_t *) pointer)[size] = 0;
+    }
+}
+
+void __dispose(Disposable_t *resource) {
+    dispose_function_t dispose_function = ((Dispose_hook_t *) resource)->_dispose_hook;
+
+    // dispose chain, each function returns the next one
+    while (dispose_function) {
+        dispose_function = (dispose_function_t) dispose_function(resource);
+    }
+}
+
+// -------------------------------------------------------------------------------------
+
+int vector_trigger(void *handle) { return 0; }
+int vector_register_raw_handler(void *handle, void *handler, bool unregister_on_dispose) { return 0; }
+void *vector_register_handler(void *handle, void *handler, void *arg_1, void *arg_2) { return handler; }
+int vector_clear_interrupt_flag(void *handle) { return 0; }
+int vector_set_enabled(void *handle, bool enabled) { return 0; }
+
+// -------------------------------------------------------------------------------------
+
+static bool _timer_channel_active;
+static uint32_t _timer_channel_compare_value;
+
+int timer_channel_start(void *handle) { _timer_channel_active = true; return 0; }
+int timer_channel_stop(void *handle) { _timer_channel_active = false; return 0; }
+bool timer_channel_is_active(void *handle) { return _timer_channel_active; }
+int timer_channel_get_counter(void *handle, uint32_t *counter) { *counter = 0; return 0; }
+int timer_channel_set_compare_value(void *handle, uint32_t value) { _timer_channel_compare_value = value; return 0; }
+uint32_t timer_channel_get_compare_value(void *handle) { return _timer_channel_compare_value; }
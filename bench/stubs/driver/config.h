@@ -0,0 +1,11 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Host stub of MSP430 driver API - driver configuration
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _BENCH_DRIVER_CONFIG_H_
+#define _BENCH_DRIVER_CONFIG_H_
+
+#endif /* _BENCH_DRIVER_CONFIG_H_ */
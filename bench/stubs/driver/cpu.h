@@ -0,0 +1,15 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Host stub of MSP430 driver API - CPU registers
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _BENCH_DRIVER_CPU_H_
+#define _BENCH_DRIVER_CPU_H_
+
+#include <stdint.h>
+
+typedef uintptr_t data_pointer_register_t;
+
+#endif /* _BENCH_DRIVER_CPU_H_ */
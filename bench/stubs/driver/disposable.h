@@ -0,0 +1,35 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Host stub of MSP430 driver API - disposable resource
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _BENCH_DRIVER_DISPOSABLE_H_
+#define _BENCH_DRIVER_DISPOSABLE_H_
+
+#include <stdint.h>
+
+typedef struct Disposable Disposable_t;
+typedef void *(*dispose_function_t)(void *);
+
+typedef struct Dispose_hook {
+    dispose_function_t _dispose_hook;
+} Dispose_hook_t;
+
+#ifndef __RESOURCE_MANAGEMENT_ENABLE__
+struct Disposable {
+    Dispose_hook_t _resource_dispose_hook;
+};
+
+#define __dispose_hook_register(_resource, _hook) \
+    ((Disposable_t *) (_resource))->_resource_dispose_hook._dispose_hook = (dispose_function_t) (_hook);
+#endif
+
+#define dispose(_resource) __dispose((Disposable_t *) (_resource))
+#define zerofill(_pointer) __do_zerofill((void *) (_pointer), sizeof(*(_pointer)))
+
+void __dispose(Disposable_t *resource);
+void __do_zerofill(void *pointer, uint16_t size);
+
+#endif /* _BENCH_DRIVER_DISPOSABLE_H_ */
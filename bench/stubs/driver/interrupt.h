@@ -0,0 +1,15 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Host stub of MSP430 driver API - no interrupts on host, critical sections are no-op
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _BENCH_DRIVER_INTERRUPT_H_
+#define _BENCH_DRIVER_INTERRUPT_H_
+
+void interrupt_suspend(void);
+void interrupt_restore(void);
+void interrupt_enable(void);
+
+#endif /* _BENCH_DRIVER_INTERRUPT_H_ */
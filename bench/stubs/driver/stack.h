@@ -0,0 +1,17 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Host stub of MSP430 driver API - no context switch on host, benchmark runs within single process
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _BENCH_DRIVER_STACK_H_
+#define _BENCH_DRIVER_STACK_H_
+
+#define deferred_stack_pointer_init(_stack_pointer, _stack, _stack_size) (void) 0
+#define deferred_stack_push_return_address(_stack_pointer, _return_address) (void) 0
+#define deferred_stack_context_init(_stack_pointer, _entry_point, _arg_1, _arg_2) (void) 0
+#define stack_save_context(_stack_pointer) (void) 0
+#define stack_restore_context(_stack_pointer) (void) 0
+
+#endif /* _BENCH_DRIVER_STACK_H_ */
@@ -0,0 +1,26 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Host stub of MSP430 driver API - timer channel, counter does not run
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _BENCH_DRIVER_TIMER_H_
+#define _BENCH_DRIVER_TIMER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <driver/vector.h>
+
+typedef struct Timer_channel_handle {
+    Vector_handle_t vector;
+} Timer_channel_handle_t;
+
+int timer_channel_start(void *handle);
+int timer_channel_stop(void *handle);
+bool timer_channel_is_active(void *handle);
+int timer_channel_get_counter(void *handle, uint32_t *counter);
+int timer_channel_set_compare_value(void *handle, uint32_t value);
+uint32_t timer_channel_get_compare_value(void *handle);
+
+#endif /* _BENCH_DRIVER_TIMER_H_ */
@@ -0,0 +1,23 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Host stub of MSP430 driver API - interrupt vectors
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _BENCH_DRIVER_VECTOR_H_
+#define _BENCH_DRIVER_VECTOR_H_
+
+#include <stdbool.h>
+
+typedef struct Vector_handle {
+    int _unused;
+} Vector_handle_t;
+
+int vector_trigger(void *handle);
+int vector_register_raw_handler(void *handle, void *handler, bool unregister_on_dispose);
+void *vector_register_handler(void *handle, void *handler, void *arg_1, void *arg_2);
+int vector_clear_interrupt_flag(void *handle);
+int vector_set_enabled(void *handle, bool enabled);
+
+#endif /* _BENCH_DRIVER_VECTOR_H_ */
@@ -116,7 +116,8 @@ void action_default_release(Action_t *action);
  * priority inheritance (change of action priority triggers change of priority of queue owner), then stack size is constant
  *    - calls to action_default_set_priority() within nested call always return false since they only create request
  * to change priority of given action, request itself is processed after nested call returns
- *    - it is only valid to create single priority change request within nested call (within queue hooks)
+ *    - up to __ACTION_PRIORITY_REQUEST_CNT__ priority change requests can be created within single nested call (within
+ * queue hooks), e.g. to pass priority to multiple lock holders, further requests are executed right away (nested)
  *  - for behavior when trigger_all() is running {@see action_queue_init}
  *  - return true if action has highest priority on queue it is linked to and if that queue is sorted
  */
@@ -25,6 +25,8 @@
 #define action_queue_pop(_queue) (_queue)->pop(_queue)
 #define action_queue_trigger_all(_queue, _signal) (_queue)->trigger_all((_queue), signal(_signal))
 #define action_queue_close(_queue, _signal) (_queue)->close((_queue), signal(_signal))
+#define action_queue_merge(_target, _source) action_queue_transfer(_target, _source, NULL)
+#define action_queue_splice(_target, _source, _last) action_queue_transfer(_target, _source, action(_last))
 
 //<editor-fold desc="variable-args - action_queue_create()">
 #define _ACTION_QUEUE_CREATE_GET_MACRO(_1,_2,_3,_4,_5,NAME,...) NAME
@@ -43,6 +45,7 @@
 #define action_queue_owner(_queue) (_queue)->_owner
 #define action_queue_get_head_priority(_queue) (_queue)->_head_priority
 #define action_queue_on_head_priority_changed(_queue) (_queue)->_on_head_priority_changed
+#define action_queue_on_released(_queue) (_queue)->_on_released
 
 // -------------------------------------------------------------------------------------
 
@@ -53,6 +56,13 @@
  */
 typedef void (*head_priority_changed_hook_t)(void *owner, priority_t, Action_queue_t *origin);
 
+/**
+ * Action queue 'on released' hook interface
+ *  - triggered after action is released from queue other than by pop() - e.g. on timeout, on dispose or when
+ * inserted to another queue, typical usage - owner passes resource to next action when waiting one leaves
+ */
+typedef void (*action_queue_released_hook_t)(void *owner, Action_t *action, Action_queue_t *origin);
+
 /**
  * Action queue, queue manipulation interface
  */
@@ -63,6 +73,8 @@ struct Action_queue {
     void *_owner;
     // hook triggered when priority of queue head changes, only applies for sorted queue
     head_priority_changed_hook_t _on_head_priority_changed;
+    // optional hook triggered when action is released from queue other than by pop(), {@see action_queue_released_hook_t}
+    action_queue_released_hook_t _on_released;
 
     // -------- state --------
     // priority of item with highest priority (applies for sorted queue)
@@ -120,5 +132,22 @@ void action_queue_init(Action_queue_t *queue, bool sorted, bool strict_sorting,
 
 // -------------------------------------------------------------------------------------
 
+/**
+ * Move actions from head of 'source' up to and including 'last' (whole queue if NULL) to 'target'
+ *  - 'last' must be linked to 'source', actions are taken in 'source' order
+ *  - if 'target' is sorted, actions are merged in single pass over both queues when 'source' is sorted too
+ * (O(n + m) instead of O(n * m) of repeated insert), actions with the same priority are placed behind those
+ * already present in 'target' like with insert
+ *  - if 'target' is FIFO, actions are appended to its end in 'source' order
+ *  - on_released hook of each moved action is triggered with 'source' as origin, as if it was released
+ *  - head priority hooks of both queues are triggered no more than once, on_released hook of 'source' is triggered
+ * for each moved action after head priority of 'source' is updated
+ *  - if 'target' is closed, actions are just released from 'source'
+ *  - if trigger_all() is running on 'source', moved actions shall not be triggered by it
+ */
+void action_queue_transfer(Action_queue_t *target, Action_queue_t *source, Action_t *last);
+
+// -------------------------------------------------------------------------------------
+
 
 #endif /* _SYS_ACTION_QUEUE_H_ */
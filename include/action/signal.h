@@ -41,6 +41,46 @@
 #define action_signal_keep_priority_while_handled(_signal) action_signal(_signal)->_keep_priority_while_handled
 #define action_signal_schedule_config(_signal) (&(action_signal(_signal)->_schedule_config))
 #define action_signal_on_handled(_signal) action_signal(_signal)->on_handled
+#ifdef __SIGNAL_PAYLOAD_FIFO_ENABLE__
+#define action_signal_payload_fifo(_signal) action_signal(_signal)->_payload_fifo
+#endif
+
+#ifdef __SIGNAL_PAYLOAD_FIFO_ENABLE__
+
+#define signal_fifo(_fifo) ((Signal_fifo_t *) (_fifo))
+
+/**
+ * Signal payload FIFO public API access
+ *  - typical usage:
+ *    signal_fifo_declare(sample_fifo, 8);
+ *    signal_fifo_create(&sample_fifo, SIGNAL_FIFO_DROP_OLDEST);
+ *    ...
+ *    action_signal_payload_fifo(&sample_event) = signal_fifo(&sample_fifo);
+ */
+#define signal_fifo_declare(_name, _capacity) \
+    struct { Signal_fifo_t _fifo; signal_t _buffer[_capacity]; } _name
+#define signal_fifo_create(_fifo, _overflow_policy) signal_fifo_register(signal_fifo(_fifo), (_fifo)->_buffer, \
+        sizeof((_fifo)->_buffer) / sizeof((_fifo)->_buffer[0]), _overflow_policy)
+
+// getter, setter
+#define signal_fifo_capacity(_fifo) signal_fifo(_fifo)->_capacity
+#define signal_fifo_cnt(_fifo) signal_fifo(_fifo)->_cnt
+#define signal_fifo_high_water_mark(_fifo) signal_fifo(_fifo)->_high_water_mark
+#define signal_fifo_overflow_cnt(_fifo) signal_fifo(_fifo)->_overflow_cnt
+
+/**
+ * Signal payload FIFO overflow policy - which payload is lost when signal is triggered while FIFO is full
+ */
+#define SIGNAL_FIFO_DROP_OLDEST     ((uint8_t) 0x00)
+#define SIGNAL_FIFO_DROP_NEWEST     ((uint8_t) 0x01)
+
+/**
+ * Signal payload FIFO API return codes
+ */
+#define SIGNAL_FIFO_SUCCESS             KERNEL_API_SUCCESS
+#define SIGNAL_FIFO_INVALID_ARGUMENT    KERNEL_API_INVALID_ARGUMENT
+
+#endif /* __SIGNAL_PAYLOAD_FIFO_ENABLE__ */
 
 // -------------------------------------------------------------------------------------
 
@@ -48,6 +88,32 @@ typedef struct Action_signal Action_signal_t;
 
 typedef bool (*signal_handler_t)(void *owner, signal_t signal);
 
+#ifdef __SIGNAL_PAYLOAD_FIFO_ENABLE__
+
+/**
+ * Bounded ring of signal payloads the signal was triggered with and which were not handled yet
+ */
+typedef struct Signal_fifo {
+    // caller-provided ring
+    signal_t *_buffer;
+    uint16_t _capacity;
+    // SIGNAL_FIFO_DROP_OLDEST or SIGNAL_FIFO_DROP_NEWEST
+    uint8_t _overflow_policy;
+
+    // -------- state --------
+    // index of oldest payload
+    uint16_t _head;
+    // number of payloads stored right now
+    uint16_t _cnt;
+    // highest number of payloads stored at the same time
+    uint16_t _high_water_mark;
+    // number of payloads lost due to overflow
+    uint16_t _overflow_cnt;
+
+} Signal_fifo_t;
+
+#endif
+
 /**
  * Action executed within context of linked process
  */
@@ -67,19 +133,43 @@ struct Action_signal {
     // - if set, return true to stay in pending_signals queue
     bool (*on_handled)(Action_signal_t *_this);
 
+#ifdef __SIGNAL_PAYLOAD_FIFO_ENABLE__
+    // if set, every payload signal was triggered with is passed to handler in order of triggers, {@see signal_fifo_register()}
+    Signal_fifo_t *_payload_fifo;
+#endif
+
 };
 
 /**
  * Initialize signal action
  *  - on trigger insert itself to pending_signals of 'context' and schedule it if it is in waiting state
  *  - 'handler' is executed within 'context' with two arguments - action owner and signal this action was triggered with
- *  - if triggered faster than handled then 'signal' parameter passed to handler is the last signal this action was triggered with
+ *  - if triggered faster than handled then 'signal' parameter passed to handler is the last signal this action was triggered with,
+ * unless payload FIFO is set, {@see signal_fifo_register()}
  *  - signal by default inherits priority of running process or priority given by schedule config if higher
  *  - 'context' inherits priority of all pending (unhandled) signals
  */
 void action_signal_register(Action_signal_t *signal, dispose_function_t dispose_hook, signal_handler_t handler,
         Schedule_config_t *with_config, Process_control_block_t *context);
 
+#ifdef __SIGNAL_PAYLOAD_FIFO_ENABLE__
+
+/**
+ * Initialize payload FIFO over caller-provided ring of 'capacity' payloads
+ *  - once set to signal, {@see action_signal_payload_fifo()}, each trigger stores it's payload to FIFO in O(1) (ISR safe)
+ * and handler is executed once per stored payload in order of triggers instead of just with the last one
+ *  - payload the pending signal is going to be (or is being) handled with is not stored in FIFO, therefore up to
+ * 'capacity' + 1 payloads are kept, unhandled trigger count of signal equals to number of stored payloads + 1
+ *  - on overflow either the oldest stored payload is overwritten or the new one is discarded according to
+ * 'overflow_policy', lost payloads are counted in overflow counter
+ *  - release of signal from pending queue by user (not after handled) discards all stored payloads
+ *  - FIFO must only be set to signal that is not pending and it must not be shared among signals
+ *  - return SIGNAL_FIFO_INVALID_ARGUMENT if 'capacity' is 0 or 'overflow_policy' is invalid
+ */
+signal_t signal_fifo_register(Signal_fifo_t *fifo, signal_t *buffer, uint16_t capacity, uint8_t overflow_policy);
+
+#endif
+
 // -------------------------------------------------------------------------------------
 
 /**
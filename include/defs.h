@@ -49,6 +49,13 @@
  */
 //#define __SIGNAL_CLEAR_WDT_ON_HANDLED__
 
+/**
+ * allow signals (and events) to keep every payload they were triggered with in bounded FIFO until handled instead of
+ * passing just the last one to handler, {@see signal_fifo_register()}
+ *  - costs one pointer per each action signal
+ */
+//#define __SIGNAL_PAYLOAD_FIFO_ENABLE__
+
 /**
  * start WDT for specified interval after signal processor is started
  *  - {@see WDT_clr_interval()} of used driverlib for options
@@ -60,6 +67,7 @@
  * to convert seconds or milliseconds to microseconds, the multiplication by 1000 is required, {@see time_unit_from()},
  * and there might be no 'mul' instruction or no external HW multiplier
  *  - the default multiplication by 1000 using bit shifts is only optimized for 16-bit instructions
+ *  - does not apply to constant amounts, time_unit_from() is folded at compile time then (GCC)
  *  - if external HW multiplier is used then it's usage should be thread-safe
  */
 //#define __TIMING_CONVERSION_AVOID_HW_MULTIPLICATION__
@@ -69,6 +77,65 @@
  */
 //#define __TIMING_QUEUE_HANDLER_PRIORITY__     ((uint16_t) (0xFF00))
 
+/**
+ * timed signals scheduled beyond next timer compare increment are kept in hierarchical timing wheel (O(1) insert and cancel),
+ * default [3, 3]
+ *  - each level has 2^__TIMING_WHEEL_SLOT_BITS__ slots, first level slot spans largest power of 2 usecs not exceeding
+ * timer overflow increment, slot of each next level spans whole previous level
+ *  - signals are cascaded to lower level when slot boundary is reached, signals beyond wheel range are kept on last level
+ *  - each slot is an action queue, RAM usage is __TIMING_WHEEL_LEVELS__ * 2^__TIMING_WHEEL_SLOT_BITS__ * sizeof(Action_queue_t)
+ *  - __TIMING_WHEEL_SLOT_BITS__ * __TIMING_WHEEL_LEVELS__ must not exceed 31, __TIMING_WHEEL_LEVELS__ must be at least 1
+ */
+//#define __TIMING_WHEEL_SLOT_BITS__            3
+//#define __TIMING_WHEEL_LEVELS__               3
+
+/**
+ * number of timing channels - timer handles with timed signal queues (and timing wheel) of their own, default [1]
+ *  - e.g. low-power timer for long-period signals with large slack and fast timer for the rest, so that the fast timer
+ * does not have to be kept running (and reprogrammed) because of long-period workload, {@see timing_reinit()}
+ *  - absolute time (get_current_time(), deadlines) is kept by default channel
+ */
+//#define __TIMING_CHANNEL_CNT__                1
+
+/**
+ * collect lateness statistics of timed signals - global and per signal, {@see Timing_statistics_t}
+ *  - lateness at trigger is measured when signal is passed to it's execution context, lateness at handler start
+ * is measured within wait() right before signal handler is executed
+ *  - costs one timer read per handled timed signal and sizeof(Timing_statistics_t) per each timed signal
+ */
+//#define __TIMING_STATISTICS_ENABLE__
+
+/**
+ * disable busy-wait of very short timed suspend (usleep(20)) - by default delays shorter than busy-wait threshold
+ * are waited for by spinning on timer counter of default timing channel with interrupts enabled, the process is kept
+ * runnable and no timed signal is scheduled, {@see timing_busy_wait()}
+ */
+//#define __TIMING_BUSY_WAIT_DISABLE__
+
+/**
+ * busy-wait threshold in usecs, default [50] - approximate cost of timed suspend path (timed signal insert, context
+ * switch to signal processor, timer compare value set, wakeup and context switch back), which depends on CPU clock
+ * and cannot be measured before processes run
+ *  - threshold is never below the time it takes to set timer compare value (measured on timing_reinit()), delays
+ * shorter than that would be triggered right away anyway
+ */
+//#define __TIMING_BUSY_WAIT_THRESHOLD__        50
+
+/**
+ * collect contention statistics of each mutex and keep list of all mutexes, {@see Mutex_statistics_t}
+ *  - wait and hold times are measured by default timing channel, time tracking should be enabled
+ * (set_track_current_time()) unless timed signals are scheduled all the time
+ *  - costs two timer reads per lock / unlock and sizeof(Mutex_statistics_t) plus one pointer per each mutex
+ */
+//#define __MUTEX_STATISTICS_ENABLE__
+
+/**
+ * number of priority change requests that can be created within single nested call of action_default_set_priority()
+ * (from queue hooks) and processed without stack growth, default [4]
+ *  - priority inheritance passed to multiple lock holders at once (reader set of RWLock_t) creates request per holder
+ */
+//#define __ACTION_PRIORITY_REQUEST_CNT__       4
+
 /**
  * clear interrupt flag on context switch handle inside interrupt service
  *  - must be defined if interrupt flag is not cleared automatically by hardware
@@ -121,6 +188,11 @@ typedef struct Time_unit Time_unit_t;
  */
 typedef struct Action_queue Action_queue_t;
 
+/**
+ * Defined in sync/mutex.h
+ */
+typedef struct Mutex Mutex_t;
+
 /**
  * Defined in scheduler.c
  */
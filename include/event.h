@@ -13,10 +13,13 @@
 #include <action/signal.h>
 #include <action/queue.h>
 #include <scheduler.h>
+#include <time.h>
 
 // -------------------------------------------------------------------------------------
 
 #define event(_event) ((Event_t *) (_event))
+#define event_topic(_topic) ((Event_topic_t *) (_topic))
+#define event_filter(_filter) ((Event_filter_t *) (_filter))
 
 /**
  * Event public API access
@@ -25,7 +28,17 @@
 #define event_subscribe(_event, _action) event(_event)->subscribe(event(_event), action(_action))
 #define event_wait(...) _EVENT_WAIT_GET_MACRO(__VA_ARGS__, _event_wait_3, _event_wait_2, _event_wait_1)(__VA_ARGS__)
 #define event_trigger(_event, _signal) action_trigger(_event, _signal)
-#define event_trigger_sync(_event, _signal) action_queue_trigger_all(&(_event)->_subscription_list, _signal)
+#define event_trigger_sync(_event, _signal) action_handler(_event)(action_owner(_event), signal(_signal))
+#define event_topic_create(...) _EVENT_TOPIC_CREATE_GET_MACRO(__VA_ARGS__, _event_topic_create_4, _event_topic_create_3)(__VA_ARGS__)
+#define event_topic_subscribe(_topic, _action) event_topic(_topic)->subscribe(event_topic(_topic), action(_action))
+#define event_filter_create(_filter, _event, _mode, _window_usecs) \
+    event_filter_register(event_filter(_filter), event(_event), _mode, (uint32_t) (_window_usecs))
+
+// getter, setter
+// number of triggers merged into last delivered signal of event with EVENT_FILTER_COALESCE, 1 if not filtered
+#define event_coalesced_cnt(_event) (event(_event)->_filter ? event(_event)->_filter->_coalesced_cnt : 1)
+// number of triggers that did not reach execution context of event due to filter
+#define event_filter_suppressed_cnt(_filter) event_filter(_filter)->_suppressed_cnt
 
 //<editor-fold desc="variable-args - event_create()">
 #define _EVENT_CREATE_GET_MACRO(_1,_2,_3,NAME,...) NAME
@@ -35,6 +48,13 @@
 #endif
 #define _event_create_3(_event, _with_config, _context) event_register(event(_event), _with_config, _context)
 //</editor-fold>
+//<editor-fold desc="variable-args - event_topic_create()">
+#define _EVENT_TOPIC_CREATE_GET_MACRO(_1,_2,_3,_4,NAME,...) NAME
+#define _event_topic_create_3(_topic, _event, _key) \
+    event_topic_register(event_topic(_topic), event(_event), (intptr_t) (_key), (intptr_t) (_key))
+#define _event_topic_create_4(_topic, _event, _key_min, _key_max) \
+    event_topic_register(event_topic(_topic), event(_event), (intptr_t) (_key_min), (intptr_t) (_key_max))
+//</editor-fold>
 //<editor-fold desc="variable-args - event_wait()">
 #define _EVENT_WAIT_GET_MACRO(_1,_2,_3,NAME,...) NAME
 #define _event_wait_1(_event) event(_event)->wait(event(_event), NULL, NULL)
@@ -50,9 +70,19 @@
 #define EVENT_DISPOSED          KERNEL_DISPOSED_RESOURCE_ACCESS
 #define EVENT_WAIT_TIMEOUT      KERNEL_API_TIMEOUT
 
+/**
+ * Event filter modes
+ *  - DEBOUNCE - leading edge, first trigger is delivered right away, triggers within window after it are ignored
+ *  - COALESCE - trailing edge, event is delivered once with the last signal when window passes since the last trigger
+ */
+#define EVENT_FILTER_DEBOUNCE   ((uint8_t) 0x01)
+#define EVENT_FILTER_COALESCE   ((uint8_t) 0x02)
+
 // -------------------------------------------------------------------------------------
 
 typedef struct Event Event_t;
+typedef struct Event_topic Event_topic_t;
+typedef struct Event_filter Event_filter_t;
 
 /**
  * Event - action list executed within context of linked process after triggered
@@ -62,6 +92,16 @@ struct Event {
     Action_signal_t _signalable;
     // list of actions subscribed to this event
     Action_queue_t _subscription_list;
+    // topics sorted by key_min in ascending order, {@see event_topic_register()}
+    Event_topic_t *_topic_index;
+    // time-window filter applied on trigger, {@see event_filter_register()}
+    Event_filter_t *_filter;
+
+    // -------- state --------
+    // list trigger_all() is running on, if dispatch is running
+    Action_queue_t *_dispatched_list;
+    // dispatch of current signal ended by event_stop_propagation()
+    bool _propagation_stopped;
 
     // -------- public --------
     // add action to subscription list
@@ -86,5 +126,80 @@ struct Event {
  */
 void event_register(Event_t *event, Schedule_config_t *with_config, Process_control_block_t *context);
 
+/**
+ * Event topic - actions subscribed to range of signal values of single event
+ */
+struct Event_topic {
+    // list of actions subscribed to this topic
+    Action_queue_t _subscription_list;
+    // event the topic belongs to
+    Event_t *_event;
+    // signal values (cast to intptr_t) within [key_min, key_max] are dispatched to this topic
+    intptr_t _key_min;
+    intptr_t _key_max;
+    // next topic in event topic index
+    Event_topic_t *_next;
+
+    // -------- public --------
+    // add action to topic subscription list
+    signal_t (*subscribe)(Event_topic_t *_this, Action_t *);
+
+};
+
+/**
+ * Initialize topic of given event and place it to event topic index
+ *  - on event trigger, only subscriptions of topics whose key range contains the signal are triggered, followed by
+ * subscriptions of event itself, so that subscriptions interested in specific signals need no signal interceptor
+ * that would filter out others - dispatch is O(topics with key_min <= signal + matching subscriptions)
+ *  - topics may overlap, each matching topic is dispatched in key_min order
+ *  - event priority is inherited from subscription lists of both event and all of it's topics
+ *  - topic is registered for the whole event lifetime, event dispose closes topic subscription list as well
+ *  - return EVENT_INVALID_ARGUMENT if key_min > key_max
+ */
+signal_t event_topic_register(Event_topic_t *topic, Event_t *event, intptr_t key_min, intptr_t key_max);
+
+/**
+ * Event filter - time window debounce / coalescing of event triggers
+ */
+struct Event_filter {
+    // interrupt context timed signal, scheduled while window is open
+    Timed_signal_t _window;
+    // event the filter belongs to
+    Event_t *_event;
+    // EVENT_FILTER_DEBOUNCE or EVENT_FILTER_COALESCE
+    uint8_t _mode;
+
+    // -------- state --------
+    // the last signal event was triggered with within open window (coalesce)
+    signal_t _last_signal;
+    // number of triggers within open window (coalesce)
+    uint16_t _trigger_cnt;
+    // number of triggers merged into last delivered signal (coalesce)
+    uint16_t _coalesced_cnt;
+    // number of triggers not passed to execution context
+    uint32_t _suppressed_cnt;
+
+};
+
+/**
+ * Initialize filter of given event - triggers are filtered within trigger context (typically interrupt service)
+ * before signal_trigger(), so that filtered triggers cost neither pending queue insert nor context switch
+ *  - EVENT_FILTER_DEBOUNCE - retriggers within 'window_usecs' since the last delivered trigger are ignored
+ *  - EVENT_FILTER_COALESCE - each trigger (re)starts window, event is triggered with the last signal once the window
+ * passes with no more triggers, number of merged triggers is available to subscriptions via event_coalesced_cnt()
+ *  - window is interrupt context timed signal, no signal processor is involved when it passes
+ *  - if timing cannot be started then filter has no effect (each trigger is delivered right away)
+ *  - filter is set for the whole event lifetime, return EVENT_INVALID_ARGUMENT on invalid 'mode' or zero window
+ */
+signal_t event_filter_register(Event_filter_t *filter, Event_t *event, uint8_t mode, uint32_t window_usecs);
+
+/**
+ * End dispatch of signal event is being dispatched with right after current subscription
+ *  - to be called by subscription that consumes the signal within dispatch (synchronous action handler or signal
+ * interceptor of subscription), no more subscriptions (of any topic or event itself) are triggered with that signal
+ *  - no effect if event is not being dispatched
+ */
+void event_stop_propagation(Event_t *event);
+
 
 #endif /* _SYS_EVENT_H_ */
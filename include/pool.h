@@ -0,0 +1,124 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Fixed-size object pool - O(1) allocation of kernel objects, release on dispose
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _SYS_POOL_H_
+#define _SYS_POOL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <defs.h>
+#include <resource.h>
+
+// -------------------------------------------------------------------------------------
+
+#define pool(_pool) ((Pool_t *) (_pool))
+
+/**
+ * Pool public API access
+ *  - typical usage:
+ *    pool_declare(timer_pool, Timed_signal_t, 16);
+ *    pool_create(&timer_pool);
+ *    ...
+ *    Timed_signal_t *timer = pool_alloc(&timer_pool);
+ *    timed_signal_create(timer, handler);
+ *    pool_item_bind(timer);    // dispose(timer) shall return timer to timer_pool
+ */
+#define pool_declare(_name, _type, _capacity) \
+    struct { Pool_t _pool; struct { Pool_item_header_t _header; _type _item; } _blocks[_capacity]; } _name
+#define pool_create(_pool) pool_register(pool(_pool), (_pool)->_blocks, sizeof((_pool)->_blocks[0]), \
+        sizeof((_pool)->_blocks) / sizeof((_pool)->_blocks[0]), offsetof(__typeof__((_pool)->_blocks[0]), _item))
+#define pool_alloc(_pool) ((__typeof__(&(_pool)->_blocks[0]._item)) pool_allocate(pool(_pool)))
+#define pool_item_bind(_item) pool_item_dispose_bind((void *) (_item))
+#define pool_free(_item) pool_item_release((void *) (_item))
+
+// getter, setter
+#define pool_capacity(_pool) pool(_pool)->_capacity
+#define pool_allocated_cnt(_pool) pool(_pool)->_allocated_cnt
+#define pool_high_water_mark(_pool) pool(_pool)->_high_water_mark
+#define pool_failed_alloc_cnt(_pool) pool(_pool)->_failed_alloc_cnt
+#define pool_is_empty(_pool) ( ! pool(_pool)->_free_list)
+
+/**
+ * Pool API return codes
+ */
+#define POOL_SUCCESS                KERNEL_API_SUCCESS
+#define POOL_INVALID_ARGUMENT       KERNEL_API_INVALID_ARGUMENT
+#define POOL_ITEM_RELEASED          KERNEL_API_INVALID_STATE
+
+// -------------------------------------------------------------------------------------
+
+typedef struct Pool Pool_t;
+
+/**
+ * Pool item header, placed right before each item
+ */
+typedef struct Pool_item_header {
+    // pool the item was allocated from, NULL while item is free
+    Pool_t *_pool;
+    // next free item header (applies if item is free)
+    struct Pool_item_header *_next;
+    // original head of item dispose chain (applies if item is bound to pool)
+    dispose_function_t _dispose_hook;
+
+} Pool_item_header_t;
+
+/**
+ * Fixed-size pool of items of the same type
+ */
+struct Pool {
+    // chain of free items, allocation pops, release pushes
+    Pool_item_header_t *_free_list;
+
+    // -------- state --------
+    // number of items allocated right now
+    uint16_t _allocated_cnt;
+    // highest number of items allocated at the same time
+    uint16_t _high_water_mark;
+    // number of allocation requests that failed because pool was exhausted
+    uint16_t _failed_alloc_cnt;
+    // total number of items
+    uint16_t _capacity;
+
+};
+
+/**
+ * Initialize pool over given block array, all items are free after this call
+ *  - use pool_declare() and pool_create() to get the layout right, each block is header immediately followed by item
+ *  - return POOL_INVALID_ARGUMENT if item does not immediately follow header (item alignment stricter than header's)
+ */
+signal_t pool_register(Pool_t *pool, void *blocks, uint16_t block_size, uint16_t capacity, uint16_t item_offset);
+
+// -------------------------------------------------------------------------------------
+
+/**
+ * Take free item from pool in O(1), return NULL and increment failure counter if pool is exhausted
+ *  - thread-safe, can be called from interrupt service
+ *  - item content is not reset, it is up to the constructor of given type
+ */
+void *pool_allocate(Pool_t *pool);
+
+/**
+ * Return item to the pool it was allocated from in O(1)
+ *  - thread-safe, can be called from interrupt service
+ *  - item is not disposed, use it only for items that were not bound or that were disposed already
+ *  - repeated release (or release of item already returned by dispose) has no effect, POOL_ITEM_RELEASED is returned
+ */
+signal_t pool_item_release(void *item);
+
+/**
+ * Make dispose() of given item return it to its pool
+ *  - must be called after item constructor, which (re)registers item dispose chain
+ *  - on dispose the whole original dispose chain is executed first (including resource list removal when resource
+ * management is enabled), then item is released to pool, therefore items owned by process are reclaimed on process exit
+ *  - disposed item keeps its content until allocated again, so that late calls to its API still reach
+ * unsupported_after_disposed()
+ */
+void pool_item_dispose_bind(void *item);
+
+
+#endif /* _SYS_POOL_H_ */
@@ -74,8 +74,10 @@
 #define sleep_long(...) __suspend_timed__(timeout_hrs(__VA_ARGS__))
 // sleep_cached() - reuse last used sleep interval, pre-cache possible by calling timeout_[interval](...)
 #define sleep_cached() __suspend_timed__(timeout_cached())
+// sleep_until(deadline) - absolute time, {@see get_current_time()}, {@see time_unit_add()}, return immediately if history
+#define sleep_until(_deadline) __suspend_timed__(timeout_until(_deadline))
 // default timed suspend entry point
-#define __suspend_timed__(_time_unit) suspend(TIMING_SIGNAL_TIMEOUT, NULL, _time_unit, process_schedule_config(&running_process))
+#define __suspend_timed__(_time_unit) suspend_timed(_time_unit, process_schedule_config(&running_process))
 
 /**
  * Delay setters on &running_process->timed_schedule
@@ -91,6 +93,9 @@
 #define timeout_hrs(...) timed_signal_set_delay_hrs(&running_process->timed_schedule, __VA_ARGS__)
 // () -> delay - reuse previously set delay
 #define timeout_cached() timed_signal_delay(&running_process->timed_schedule)
+// (deadline) -> absolute timeout of blocking call, e.g. mutex_lock(&mutex, timeout_until(&deadline))
+#define timeout_until(_time_unit) (running_process->_deadline = *(_time_unit), &running_process->_deadline)
+#define timeout_is_deadline(_timeout) ((_timeout) == &running_process->_deadline)
 
 #endif /* __SIGNAL_PROCESSOR_DISABLE__ */
 
@@ -165,11 +170,15 @@ struct Process_control_block {
     Schedule_config_t _schedule_config;
     // queue of actions to be executed on process disposal
     Action_queue_t on_exit_action_queue;
+    // mutexes held without contention, linked to on_exit_action_queue on contention or on process disposal
+    Mutex_t *_held_mutex_list;
     // queue of actions of type signal waiting to be executed within waiting state
     Action_queue_t pending_signal_queue;
 #ifndef __SIGNAL_PROCESSOR_DISABLE__
     // signal used to wakeup process from blocking states (blocking wait with timeout)
     Timed_signal_t timed_schedule;
+    // absolute timeout of blocking call, only timeout pointing here is deadline, {@see timeout_until()}
+    Time_unit_t _deadline;
 #endif
 };
 
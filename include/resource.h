@@ -42,6 +42,15 @@ struct Disposable {
  */
 void resource_mark(Process_control_block_t *, Disposable_t *, dispose_function_t);
 
+/**
+ * Move resource to resource_list of another owner, keep its dispose chain untouched
+ *  - resource is released on exit of new owner from now on (e.g. pool item bound to pool is returned to pool)
+ *  - if new owner is empty, resource is detached - it is not released on exit of any process until it is transferred
+ * to another owner, dispose() still runs its whole chain
+ *  - nothing to be done if resource is not owned by any process (and was not detached)
+ */
+void resource_owner_transfer(Process_control_block_t *owner, Disposable_t *resource);
+
 
 #endif /* __RESOURCE_MANAGEMENT_ENABLE__ */
 
@@ -101,6 +101,14 @@ signal_t wait(Time_unit_t *timeout, Schedule_config_t *with_config);
  */
 signal_t suspend(signal_t blocked_state_condition, Action_queue_t *queue, Time_unit_t *timeout, Schedule_config_t *with_config);
 
+/**
+ * Suspend running process for given delay / until given deadline (usleep(), sleep(), sleep_until()...)
+ *  - delay shorter than busy-wait threshold is waited for by spinning with interrupts enabled instead, process is kept
+ * runnable, {@see timing_busy_wait()}
+ *  - return TIMING_SIGNAL_TIMEOUT
+ */
+signal_t suspend_timed(Time_unit_t *timeout, Schedule_config_t *with_config);
+
 // -------------------------------------------------------------------------------------
 
 /**
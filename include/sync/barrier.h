@@ -0,0 +1,140 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Cyclic barrier and countdown latch
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _SYS_SYNC_BARRIER_H_
+#define _SYS_SYNC_BARRIER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <defs.h>
+#include <action.h>
+#include <action/queue.h>
+#include <scheduler.h>
+
+// -------------------------------------------------------------------------------------
+
+#define barrier(_barrier) ((Barrier_t *) (_barrier))
+#define latch(_latch) ((Latch_t *) (_latch))
+
+/**
+ * Barrier public API access
+ */
+#define barrier_create(_barrier, _parties) barrier_register(barrier(_barrier), _parties)
+#define barrier_wait(...) _BARRIER_WAIT_GET_MACRO(__VA_ARGS__, _barrier_wait_3, _barrier_wait_2, _barrier_wait_1)(__VA_ARGS__)
+#define barrier_arrive(_barrier) action_trigger(action(_barrier), NULL)
+
+//<editor-fold desc="variable-args - barrier_wait()">
+#define _BARRIER_WAIT_GET_MACRO(_1,_2,_3,NAME,...) NAME
+#define _barrier_wait_1(_barrier) barrier(_barrier)->wait(barrier(_barrier), NULL, NULL)
+#define _barrier_wait_2(_barrier, _timeout) barrier(_barrier)->wait(barrier(_barrier), _timeout, NULL)
+#define _barrier_wait_3(_barrier, _timeout, _with_config) barrier(_barrier)->wait(barrier(_barrier), _timeout, _with_config)
+//</editor-fold>
+
+// getter, setter
+#define barrier_parties(_barrier) barrier(_barrier)->_parties
+#define barrier_arrived_cnt(_barrier) barrier(_barrier)->_arrived_cnt
+
+/**
+ * Latch public API access
+ */
+#define latch_create(_latch, _cnt) latch_register(latch(_latch), _cnt)
+#define latch_wait(...) _LATCH_WAIT_GET_MACRO(__VA_ARGS__, _latch_wait_3, _latch_wait_2, _latch_wait_1)(__VA_ARGS__)
+#define latch_count_down(_latch) action_trigger(action(_latch), NULL)
+
+//<editor-fold desc="variable-args - latch_wait()">
+#define _LATCH_WAIT_GET_MACRO(_1,_2,_3,NAME,...) NAME
+#define _latch_wait_1(_latch) latch(_latch)->wait(latch(_latch), NULL, NULL)
+#define _latch_wait_2(_latch, _timeout) latch(_latch)->wait(latch(_latch), _timeout, NULL)
+#define _latch_wait_3(_latch, _timeout, _with_config) latch(_latch)->wait(latch(_latch), _timeout, _with_config)
+//</editor-fold>
+
+// getter, setter
+#define latch_cnt(_latch) latch(_latch)->_cnt
+
+/**
+ * Barrier and latch public API return codes
+ */
+#define BARRIER_SUCCESS         KERNEL_API_SUCCESS
+#define BARRIER_DISPOSED        KERNEL_DISPOSED_RESOURCE_ACCESS
+#define BARRIER_SERIAL          signal(1)
+#define BARRIER_WAIT_TIMEOUT    KERNEL_API_TIMEOUT
+
+#define LATCH_SUCCESS           KERNEL_API_SUCCESS
+#define LATCH_DISPOSED          KERNEL_DISPOSED_RESOURCE_ACCESS
+#define LATCH_WAIT_TIMEOUT      KERNEL_API_TIMEOUT
+
+// -------------------------------------------------------------------------------------
+
+typedef struct Barrier Barrier_t;
+typedef struct Latch Latch_t;
+
+/**
+ * Cyclic barrier of fixed number of parties
+ */
+struct Barrier {
+    // resource, arrival without waiting on trigger
+    Action_t _triggerable;
+    // number of arrivals that trip the barrier
+    uint16_t _parties;
+
+    // -------- state --------
+    // queue of processes waiting for the barrier to trip
+    Action_queue_t _queue;
+    // number of arrivals within current cycle
+    uint16_t _arrived_cnt;
+    // incremented each time barrier trips
+    uint16_t _generation;
+
+    // -------- public --------
+    // arrive and block until all parties arrive, reset priority according to given config
+    signal_t (*wait)(Barrier_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config);
+
+};
+
+/**
+ * One-shot countdown latch
+ */
+struct Latch {
+    // resource, count down on trigger
+    Action_t _triggerable;
+
+    // -------- state --------
+    // queue of processes waiting for count to reach zero
+    Action_queue_t _queue;
+    // remaining count
+    uint16_t _cnt;
+
+    // -------- public --------
+    // block until count reaches zero, reset priority according to given config
+    signal_t (*wait)(Latch_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config);
+
+};
+
+// -------------------------------------------------------------------------------------
+
+/**
+ * Initialize barrier for given number of parties (at least one)
+ *  - arrival is just counter update, waiting processes are enqueued in O(1) - no signal or context switch is involved
+ * until the last party arrives, which wakes up all waiting processes at once and resets barrier for next cycle
+ *  - last arriving party does not block, BARRIER_SERIAL is returned to it, so that it can perform per-cycle work
+ *  - party that timed out withdraws its arrival, unless barrier tripped before it was resumed (BARRIER_SUCCESS
+ * is returned then)
+ *  - barrier_arrive() counts arrival of party that does not wait (e.g. interrupt service), barrier is an action,
+ * so that it can be subscribed to events as well
+ */
+void barrier_register(Barrier_t *barrier, uint16_t parties);
+
+/**
+ * Initialize latch with initial count
+ *  - latch_count_down() is just counter update, the one reaching zero wakes up all waiting processes at once,
+ * further count down has no effect and wait returns right away from then on
+ *  - latch is an action, count down is its trigger - it can be subscribed to events or triggered from interrupt service
+ */
+void latch_register(Latch_t *latch, uint16_t cnt);
+
+
+#endif /* _SYS_SYNC_BARRIER_H_ */
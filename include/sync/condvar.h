@@ -0,0 +1,89 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Condition variable bound to mutex with wait morphing
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _SYS_SYNC_CONDVAR_H_
+#define _SYS_SYNC_CONDVAR_H_
+
+#include <stddef.h>
+#include <defs.h>
+#include <action.h>
+#include <action/queue.h>
+#include <scheduler.h>
+#include <sync/mutex.h>
+
+// -------------------------------------------------------------------------------------
+
+#define condvar(_condvar) ((Condvar_t *) (_condvar))
+
+/**
+ * Condition variable public API access
+ */
+#define condvar_create(_condvar) condvar_register(condvar(_condvar))
+#define condvar_wait(...) _CONDVAR_WAIT_GET_MACRO(__VA_ARGS__, _condvar_wait_4, _condvar_wait_3, _condvar_wait_2)(__VA_ARGS__)
+#define condvar_signal(_condvar) action_trigger(action(_condvar), NULL)
+#define condvar_broadcast(_condvar) condvar(_condvar)->broadcast(condvar(_condvar))
+
+//<editor-fold desc="variable-args - condvar_wait()">
+#define _CONDVAR_WAIT_GET_MACRO(_1,_2,_3,_4,NAME,...) NAME
+#define _condvar_wait_2(_condvar, _mutex) condvar(_condvar)->wait(condvar(_condvar), mutex(_mutex), NULL, NULL)
+#define _condvar_wait_3(_condvar, _mutex, _timeout) condvar(_condvar)->wait(condvar(_condvar), mutex(_mutex), _timeout, NULL)
+#define _condvar_wait_4(_condvar, _mutex, _timeout, _with_config) condvar(_condvar)->wait(condvar(_condvar), mutex(_mutex), _timeout, _with_config)
+//</editor-fold>
+
+/**
+ * Condition variable public API return codes
+ */
+#define CONDVAR_SUCCESS             KERNEL_API_SUCCESS
+#define CONDVAR_DISPOSED            KERNEL_DISPOSED_RESOURCE_ACCESS
+#define CONDVAR_INVALID_ARGUMENT    KERNEL_API_INVALID_ARGUMENT
+#define CONDVAR_INVALID_OWNER       signal(2)
+#define CONDVAR_WAIT_TIMEOUT        KERNEL_API_TIMEOUT
+
+// -------------------------------------------------------------------------------------
+
+typedef struct Condvar Condvar_t;
+
+/**
+ * Condition variable
+ */
+struct Condvar {
+    // resource, signal() on trigger
+    Action_t _triggerable;
+
+    // -------- state --------
+    // queue of processes waiting on this condition variable
+    Action_queue_t _queue;
+    // mutex all waiting processes released on wait
+    Mutex_t *_mutex;
+
+    // -------- public --------
+    // atomically release given mutex (held by running process) and block until signaled, mutex is held again on return
+    // - reset priority according to given config before inserting to condition variable queue
+    signal_t (*wait)(Condvar_t *_this, Mutex_t *mutex, Time_unit_t *timeout, Schedule_config_t *with_config);
+    // move all waiting processes to mutex queue
+    void (*broadcast)(Condvar_t *_this);
+
+};
+
+// -------------------------------------------------------------------------------------
+
+/**
+ * Initialize condition variable
+ *  - wait releases mutex no matter it's nesting count, the nesting count is restored when mutex is acquired again
+ *  - condvar_signal() / condvar_broadcast() do not wake up waiting process just to get blocked on mutex - instead,
+ * waiting process is moved to mutex queue directly (wait morphing) and it is woken up once it becomes mutex owner,
+ * or right away if mutex is not locked (signal from interrupt service or from process that does not hold mutex)
+ *  - timeout only applies until process is signaled, mutex is always acquired before wait returns (timeout
+ * or dispose of condition variable included)
+ *  - all processes waiting at the same time must use the same mutex, CONDVAR_INVALID_ARGUMENT is returned otherwise,
+ * CONDVAR_INVALID_OWNER is returned if running process does not hold given mutex
+ *  - condition variable is an action, condvar_signal() is its trigger - it can be subscribed to events
+ */
+void condvar_register(Condvar_t *condvar);
+
+
+#endif /* _SYS_SYNC_CONDVAR_H_ */
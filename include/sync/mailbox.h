@@ -0,0 +1,136 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Fixed-capacity mailbox - zero-copy passing of buffer ownership between processes
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _SYS_SYNC_MAILBOX_H_
+#define _SYS_SYNC_MAILBOX_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <defs.h>
+#include <action.h>
+#include <action/queue.h>
+#include <scheduler.h>
+
+// -------------------------------------------------------------------------------------
+
+#define mailbox(_mailbox) ((Mailbox_t *) (_mailbox))
+
+/**
+ * Mailbox public API access
+ *  - typical usage:
+ *    mailbox_declare(rx_mailbox, 8);               // up to 8 messages stored
+ *    mailbox_create(&rx_mailbox, true);            // messages are disposable (e.g. pool items), ownership transfer
+ *    ...
+ *    mailbox_send(&rx_mailbox, packet);            // producer
+ *    ...
+ *    mailbox_receive(&rx_mailbox, &packet);        // consumer, owns packet from now on
+ */
+#define mailbox_declare(_name, _capacity) \
+    struct { Mailbox_t _mailbox; void *_buffer[_capacity]; } _name
+#define mailbox_create(...) _MAILBOX_CREATE_GET_MACRO(__VA_ARGS__, _mailbox_create_2, _mailbox_create_1)(__VA_ARGS__)
+#define mailbox_try_send(_mailbox, _message) mailbox(_mailbox)->try_send(mailbox(_mailbox), (void *) (_message))
+#define mailbox_send(...) _MAILBOX_SEND_GET_MACRO(__VA_ARGS__, _mailbox_send_4, _mailbox_send_3, _mailbox_send_2)(__VA_ARGS__)
+#define mailbox_try_receive(_mailbox, _message) mailbox(_mailbox)->try_receive(mailbox(_mailbox), (void **) (_message))
+#define mailbox_receive(...) _MAILBOX_RECEIVE_GET_MACRO(__VA_ARGS__, _mailbox_receive_4, _mailbox_receive_3, _mailbox_receive_2)(__VA_ARGS__)
+#define mailbox_post(_mailbox, _message) action_trigger(action(_mailbox), _message)
+
+//<editor-fold desc="variable-args - mailbox_create()">
+#define _MAILBOX_CREATE_GET_MACRO(_1,_2,NAME,...) NAME
+#define _mailbox_create_1(_mailbox) mailbox_register(mailbox(_mailbox), (_mailbox)->_buffer, \
+        sizeof((_mailbox)->_buffer) / sizeof((_mailbox)->_buffer[0]), false)
+#define _mailbox_create_2(_mailbox, _transfer_ownership) mailbox_register(mailbox(_mailbox), (_mailbox)->_buffer, \
+        sizeof((_mailbox)->_buffer) / sizeof((_mailbox)->_buffer[0]), _transfer_ownership)
+//</editor-fold>
+//<editor-fold desc="variable-args - mailbox_send()">
+#define _MAILBOX_SEND_GET_MACRO(_1,_2,_3,_4,NAME,...) NAME
+#define _mailbox_send_2(_mailbox, _message) mailbox(_mailbox)->send(mailbox(_mailbox), (void *) (_message), NULL, NULL)
+#define _mailbox_send_3(_mailbox, _message, _timeout) mailbox(_mailbox)->send(mailbox(_mailbox), (void *) (_message), _timeout, NULL)
+#define _mailbox_send_4(_mailbox, _message, _timeout, _with_config) mailbox(_mailbox)->send(mailbox(_mailbox), (void *) (_message), _timeout, _with_config)
+//</editor-fold>
+//<editor-fold desc="variable-args - mailbox_receive()">
+#define _MAILBOX_RECEIVE_GET_MACRO(_1,_2,_3,_4,NAME,...) NAME
+#define _mailbox_receive_2(_mailbox, _message) mailbox(_mailbox)->receive(mailbox(_mailbox), (void **) (_message), NULL, NULL)
+#define _mailbox_receive_3(_mailbox, _message, _timeout) mailbox(_mailbox)->receive(mailbox(_mailbox), (void **) (_message), _timeout, NULL)
+#define _mailbox_receive_4(_mailbox, _message, _timeout, _with_config) mailbox(_mailbox)->receive(mailbox(_mailbox), (void **) (_message), _timeout, _with_config)
+//</editor-fold>
+
+// getter, setter
+#define mailbox_capacity(_mailbox) mailbox(_mailbox)->_capacity
+#define mailbox_message_cnt(_mailbox) mailbox(_mailbox)->_cnt
+#define mailbox_dropped_cnt(_mailbox) mailbox(_mailbox)->_dropped_cnt
+
+/**
+ * Mailbox public API return codes
+ */
+#define MAILBOX_SUCCESS             KERNEL_API_SUCCESS
+#define MAILBOX_DISPOSED            KERNEL_DISPOSED_RESOURCE_ACCESS
+#define MAILBOX_INVALID_ARGUMENT    KERNEL_API_INVALID_ARGUMENT
+#define MAILBOX_FULL                signal(1)
+#define MAILBOX_EMPTY               signal(2)
+#define MAILBOX_TIMEOUT             KERNEL_API_TIMEOUT
+
+// -------------------------------------------------------------------------------------
+
+typedef struct Mailbox Mailbox_t;
+
+/**
+ * Mailbox of pointers to caller-owned buffers
+ */
+struct Mailbox {
+    // resource, try_send() on trigger
+    Action_t _triggerable;
+    // caller-provided circular buffer of message pointers
+    void **_buffer;
+    uint16_t _capacity;
+#ifdef __RESOURCE_MANAGEMENT_ENABLE__
+    // messages are disposable resources, owner process is changed on each send / receive
+    bool _transfer_ownership;
+#endif
+
+    // -------- state --------
+    // queue of processes blocked on receive, sorted by priority
+    Action_queue_t _receiver_queue;
+    // queue of processes blocked on send to full mailbox, sorted by priority
+    Action_queue_t _sender_queue;
+    // index of oldest message
+    uint16_t _head;
+    // number of stored messages
+    uint16_t _cnt;
+    // number of messages posted by trigger to full mailbox
+    uint16_t _dropped_cnt;
+
+    // -------- public --------
+    // non-blocking send, can be called from interrupt service
+    signal_t (*try_send)(Mailbox_t *_this, void *message);
+    // send message or block until there is space in mailbox, reset priority according to given config
+    signal_t (*send)(Mailbox_t *_this, void *message, Time_unit_t *timeout, Schedule_config_t *with_config);
+    // non-blocking receive
+    signal_t (*try_receive)(Mailbox_t *_this, void **message);
+    // receive message or block until there is one, reset priority according to given config
+    signal_t (*receive)(Mailbox_t *_this, void **message, Time_unit_t *timeout, Schedule_config_t *with_config);
+
+};
+
+// -------------------------------------------------------------------------------------
+
+/**
+ * Initialize mailbox over given buffer of message pointers
+ *  - messages are never copied, only pointers are passed - message shall not be accessed by sender once sent
+ *  - message sent while some process is blocked on receive is handed over to the highest priority receiver directly,
+ * messages are stored in order of sending otherwise, senders blocked on full mailbox are woken up by priority
+ *  - empty (NULL) message is not allowed, MAILBOX_INVALID_ARGUMENT is returned
+ *  - mailbox_post() from interrupt service or by event is non-blocking send, message is dropped if mailbox is full
+ *  - 'transfer_ownership' (only applies if resource management is enabled) - messages are disposable objects owned
+ * by process (e.g. pool items bound to pool), receiver becomes owner of message, so that it is reclaimed if receiver
+ * exits or is killed without disposing it, messages stored in mailbox are not owned by any process in the meantime
+ * (they outlive their sender) and those not received are disposed along with mailbox
+ */
+void mailbox_register(Mailbox_t *mailbox, void **buffer, uint16_t capacity, bool transfer_ownership);
+
+
+#endif /* _SYS_SYNC_MAILBOX_H_ */
@@ -33,6 +33,15 @@
 #define _mutex_lock_3(_mutex, _timeout, _with_config) mutex(_mutex)->lock(mutex(_mutex), _timeout, _with_config)
 //</editor-fold>
 
+// getter, setter
+#define mutex_owner(_mutex) action_attr(_mutex, arg_2)
+#define mutex_nesting_cnt(_mutex) mutex(_mutex)->_nesting_cnt
+#ifdef __MUTEX_STATISTICS_ENABLE__
+#define mutex_statistics(_mutex) (&(mutex(_mutex)->_statistics))
+#define mutex_wait_mean(_statistics) ((_statistics)->wait_cnt ? (uint32_t) ((_statistics)->wait_sum / (_statistics)->wait_cnt) : 0)
+#define mutex_hold_mean(_statistics) ((_statistics)->hold_cnt ? (uint32_t) ((_statistics)->hold_sum / (_statistics)->hold_cnt) : 0)
+#endif
+
 /**
  * Mutex public API return codes
  */
@@ -44,7 +53,43 @@
 
 // -------------------------------------------------------------------------------------
 
-typedef struct Mutex Mutex_t;
+#ifdef __MUTEX_STATISTICS_ENABLE__
+
+/**
+ * Contention statistics of single mutex, times in usecs saturated to 32 bits
+ */
+typedef struct Mutex_statistics {
+    // number of times mutex was acquired (nested lock not included)
+    uint32_t acquired_cnt;
+    // number of acquisitions passed from releasing owner to waiting process
+    uint32_t contended_cnt;
+    // time from blocking within lock() to becoming owner, {@see mutex_wait_mean()}
+    uint32_t wait_cnt;
+    uint64_t wait_sum;
+    uint32_t wait_max;
+    // time from becoming owner to release, {@see mutex_hold_mean()}
+    uint32_t hold_cnt;
+    uint64_t hold_sum;
+    uint32_t hold_max;
+    // highest priority inherited from mutex queue head
+    priority_t inherited_priority_max;
+
+} Mutex_statistics_t;
+
+/**
+ * Snapshot entry of single mutex, {@see mutex_statistics_snapshot()}
+ */
+typedef struct Mutex_snapshot {
+    Mutex_t *mutex;
+    // owner at the time of snapshot, NULL if not locked
+    Process_control_block_t *owner;
+    // number of processes blocked on mutex at the time of snapshot
+    uint16_t waiting_cnt;
+    Mutex_statistics_t statistics;
+
+} Mutex_snapshot_t;
+
+#endif
 
 /**
  * Recursive mutex
@@ -58,6 +103,16 @@ struct Mutex {
     Action_queue_t _queue;
     // count how many times has owner acquired current mutex
     uint16_t _nesting_cnt;
+    // next mutex held by the same owner without contention
+    Mutex_t *_next_held;
+#ifdef __MUTEX_STATISTICS_ENABLE__
+    // contention statistics of this mutex
+    Mutex_statistics_t _statistics;
+    // time current owner acquired mutex at (usecs), UINT64_MAX if unknown
+    uint64_t _acquired_time;
+    // next mutex on list of all mutexes
+    Mutex_t *_next_registered;
+#endif
 
     // -------- public --------
     // non-blocking lock
@@ -78,10 +133,43 @@ struct Mutex {
 /**
  * Initialize mutex
  *  - mutex inherits priority of its queue (mutex priority equals queue head priority or 0 if queue is empty)
- *  - process inherits priority of 'on_exit_action_queue' which is where mutex is inserted when acquired {@see schedulable_state_reset}
+ *  - process inherits priority of 'on_exit_action_queue' which is where mutex is inserted once some other process
+ * blocks on it {@see schedulable_state_reset}, uncontended lock / unlock does not touch any sorted queue
  *  - if process is killed while it holds mutex or terminates without releasing it, then it is released automatically
  */
 void mutex_register(Mutex_t *mutex);
 
+/**
+ * Pass mutex to given suspended process or enqueue it to mutex queue if mutex is locked (wait morphing)
+ *  - process blocked on another queue (e.g. condition variable) is moved to mutex queue without being woken up,
+ * it is woken up once it becomes mutex owner, blocked state signal is MUTEX_SUCCESS then (MUTEX_DISPOSED on dispose)
+ *  - timeout of process blocking state is cancelled
+ */
+void mutex_requeue(Mutex_t *mutex, Process_control_block_t *process);
+
+/**
+ * Link all mutexes held by given process without contention to its on_exit_action_queue
+ *  - uncontended mutex is only recorded on '_held_mutex_list' of owner, which is O(1) on lock and unlock (mutexes
+ * are mostly unlocked in reverse order), it is linked to owner on_exit_action_queue once another process blocks on it
+ *  - called on process disposal, so that held mutexes are released on process exit (or kill)
+ */
+void mutex_held_list_link(Process_control_block_t *process);
+
+#ifdef __MUTEX_STATISTICS_ENABLE__
+
+/**
+ * Fill 'target' array by snapshot of up to 'capacity' mutexes (most recently created first), return number of mutexes
+ * that exist (which might be more than capacity)
+ *  - all entries are copied within single critical section, so that they are consistent with each other
+ */
+uint16_t mutex_statistics_snapshot(Mutex_snapshot_t *target, uint16_t capacity);
+
+/**
+ * Reset statistics of given mutex, statistics of all mutexes if NULL
+ */
+void mutex_statistics_reset(Mutex_t *mutex);
+
+#endif
+
 
 #endif /* _SYS_SYNC_MUTEX_H_ */
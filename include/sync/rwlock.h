@@ -0,0 +1,140 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Reader-writer lock with priority inheritance
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _SYS_SYNC_RWLOCK_H_
+#define _SYS_SYNC_RWLOCK_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <defs.h>
+#include <action.h>
+#include <action/queue.h>
+#include <scheduler.h>
+
+// -------------------------------------------------------------------------------------
+
+#define rwlock(_rwlock) ((RWLock_t *) (_rwlock))
+
+/**
+ * Reader-writer lock public API access
+ *  - typical usage:
+ *    rwlock_declare(table_lock, 4);                // up to 4 processes hold read lock at the same time
+ *    rwlock_create(&table_lock, true);             // writer preference
+ *    ...
+ *    rwlock_read_lock(&table_lock);
+ *    ...
+ *    rwlock_unlock(&table_lock);
+ */
+#define rwlock_declare(_name, _reader_slot_cnt) \
+    struct { RWLock_t _lock; RWLock_reader_t _readers[_reader_slot_cnt]; } _name
+#define rwlock_create(_rwlock, _writer_preference) rwlock_register(rwlock(_rwlock), (_rwlock)->_readers, \
+        sizeof((_rwlock)->_readers) / sizeof((_rwlock)->_readers[0]), _writer_preference)
+#define rwlock_try_read_lock(_rwlock) rwlock(_rwlock)->try_read_lock(rwlock(_rwlock))
+#define rwlock_read_lock(...) _RWLOCK_READ_LOCK_GET_MACRO(__VA_ARGS__, _rwlock_read_lock_3, _rwlock_read_lock_2, _rwlock_read_lock_1)(__VA_ARGS__)
+#define rwlock_try_write_lock(_rwlock) rwlock(_rwlock)->try_write_lock(rwlock(_rwlock))
+#define rwlock_write_lock(...) _RWLOCK_WRITE_LOCK_GET_MACRO(__VA_ARGS__, _rwlock_write_lock_3, _rwlock_write_lock_2, _rwlock_write_lock_1)(__VA_ARGS__)
+#define rwlock_unlock(_rwlock) rwlock(_rwlock)->unlock(rwlock(_rwlock))
+
+//<editor-fold desc="variable-args - rwlock_read_lock()">
+#define _RWLOCK_READ_LOCK_GET_MACRO(_1,_2,_3,NAME,...) NAME
+#define _rwlock_read_lock_1(_rwlock) rwlock(_rwlock)->read_lock(rwlock(_rwlock), NULL, NULL)
+#define _rwlock_read_lock_2(_rwlock, _timeout) rwlock(_rwlock)->read_lock(rwlock(_rwlock), _timeout, NULL)
+#define _rwlock_read_lock_3(_rwlock, _timeout, _with_config) rwlock(_rwlock)->read_lock(rwlock(_rwlock), _timeout, _with_config)
+//</editor-fold>
+//<editor-fold desc="variable-args - rwlock_write_lock()">
+#define _RWLOCK_WRITE_LOCK_GET_MACRO(_1,_2,_3,NAME,...) NAME
+#define _rwlock_write_lock_1(_rwlock) rwlock(_rwlock)->write_lock(rwlock(_rwlock), NULL, NULL)
+#define _rwlock_write_lock_2(_rwlock, _timeout) rwlock(_rwlock)->write_lock(rwlock(_rwlock), _timeout, NULL)
+#define _rwlock_write_lock_3(_rwlock, _timeout, _with_config) rwlock(_rwlock)->write_lock(rwlock(_rwlock), _timeout, _with_config)
+//</editor-fold>
+
+// getter, setter
+#define rwlock_reader_cnt(_rwlock) rwlock(_rwlock)->_reader_cnt
+
+/**
+ * Reader-writer lock public API return codes
+ */
+#define RWLOCK_SUCCESS          KERNEL_API_SUCCESS
+#define RWLOCK_DISPOSED         KERNEL_DISPOSED_RESOURCE_ACCESS
+#define RWLOCK_LOCKED           signal(1)
+#define RWLOCK_INVALID_OWNER    signal(2)
+#define RWLOCK_LOCK_TIMEOUT     KERNEL_API_TIMEOUT
+
+// -------------------------------------------------------------------------------------
+
+typedef struct RWLock RWLock_t;
+
+/**
+ * Read lock slot - held by single reader process
+ */
+typedef struct RWLock_reader {
+    // resource, release() on trigger, placed to on_exit_action_queue of reader process while held
+    Action_t _triggerable;
+    // lock this slot belongs to
+    RWLock_t *_lock;
+
+    // -------- state --------
+    // count how many times has reader acquired read lock
+    uint16_t _nesting_cnt;
+
+} RWLock_reader_t;
+
+/**
+ * Reader-writer lock
+ */
+struct RWLock {
+    // resource, release() on trigger, placed to on_exit_action_queue of writer process while write locked
+    Action_t _triggerable;
+    // caller-provided read lock slots
+    RWLock_reader_t *_readers;
+    uint8_t _reader_slot_cnt;
+    // waiting writer is preferred to new readers if set, waiting readers are preferred to writer otherwise
+    bool _writer_preference;
+
+    // -------- state --------
+    // queue of processes blocked on write lock
+    Action_queue_t _writer_queue;
+    // queue of processes blocked on read lock
+    Action_queue_t _reader_queue;
+    // number of processes holding read lock
+    uint8_t _reader_cnt;
+    // count how many times has writer acquired write lock
+    uint16_t _nesting_cnt;
+
+    // -------- public --------
+    // non-blocking read lock
+    signal_t (*try_read_lock)(RWLock_t *_this);
+    // acquire read lock or block until available, the same semantics as mutex lock
+    signal_t (*read_lock)(RWLock_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config);
+    // non-blocking write lock
+    signal_t (*try_write_lock)(RWLock_t *_this);
+    // acquire write lock or block until available, the same semantics as mutex lock
+    signal_t (*write_lock)(RWLock_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config);
+    // release read or write lock held by running process, wakeup next waiting process(es)
+    signal_t (*unlock)(RWLock_t *_this);
+
+};
+
+// -------------------------------------------------------------------------------------
+
+/**
+ * Initialize reader-writer lock with given read lock slots
+ *  - write lock is exclusive, read lock is shared by up to 'reader_slot_cnt' processes, both are reentrant
+ *  - writer holding the lock may acquire read lock as nested write lock, reader cannot upgrade to write lock
+ * (RWLOCK_INVALID_OWNER is returned)
+ *  - 'writer_preference' - new readers are blocked while writer is waiting and released writer lock is passed
+ * to waiting writer first, otherwise readers are admitted while lock is read locked and waiting readers are
+ * woken up first, readers blocked by waiting writer are woken up once it times out or is killed
+ *  - lock inherits priority of both its queues, write lock holder or all read lock holders inherit priority of lock
+ * via their 'on_exit_action_queue' (the same way as mutex owner does)
+ *  - if process is killed while it holds the lock or terminates without releasing it, then it is released automatically
+ */
+void rwlock_register(RWLock_t *rwlock, RWLock_reader_t *readers, uint8_t reader_slot_cnt, bool writer_preference);
+
+
+#endif /* _SYS_SYNC_RWLOCK_H_ */
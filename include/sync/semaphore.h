@@ -24,9 +24,12 @@
  */
 #define semaphore_create(...) _SEMAPHORE_CREATE_GET_MACRO(__VA_ARGS__, _semaphore_create_3, _semaphore_create_2, _semaphore_create_1)(__VA_ARGS__)
 #define semaphore_try_acquire(_semaphore) semaphore(_semaphore)->try_acquire(semaphore(_semaphore))
+#define semaphore_try_acquire_n(_semaphore, _cnt) semaphore(_semaphore)->try_acquire_n(semaphore(_semaphore), _cnt)
 #define semaphore_acquire(...) _SEMAPHORE_ACQUIRE_GET_MACRO(__VA_ARGS__, _semaphore_acquire_3, _semaphore_acquire_2, _semaphore_acquire_1)(__VA_ARGS__)
+#define semaphore_acquire_n(...) _SEMAPHORE_ACQUIRE_N_GET_MACRO(__VA_ARGS__, _semaphore_acquire_n_4, _semaphore_acquire_n_3, _semaphore_acquire_n_2)(__VA_ARGS__)
 #define semaphore_acquire_async(_semaphore, _action) semaphore(_semaphore)->acquire_async(semaphore(_semaphore), action(_action))
 #define semaphore_signal(_semaphore, _signal) action_trigger(action(_semaphore), _signal)
+#define semaphore_release_n(_semaphore, _cnt) semaphore(_semaphore)->release_n(semaphore(_semaphore), _cnt, SEMAPHORE_SUCCESS)
 
 //<editor-fold desc="variable-args - semaphore_create()">
 #define _SEMAPHORE_CREATE_GET_MACRO(_1,_2,_3,NAME,...) NAME
@@ -42,6 +45,12 @@
 #define _semaphore_acquire_2(_semaphore, _timeout) semaphore(_semaphore)->acquire(semaphore(_semaphore), _timeout, NULL)
 #define _semaphore_acquire_3(_semaphore, _timeout, _with_config) semaphore(_semaphore)->acquire(semaphore(_semaphore), _timeout, _with_config)
 //</editor-fold>
+//<editor-fold desc="variable-args - semaphore_acquire_n()">
+#define _SEMAPHORE_ACQUIRE_N_GET_MACRO(_1,_2,_3,_4,NAME,...) NAME
+#define _semaphore_acquire_n_2(_semaphore, _cnt) semaphore(_semaphore)->acquire_n(semaphore(_semaphore), _cnt, NULL, NULL)
+#define _semaphore_acquire_n_3(_semaphore, _cnt, _timeout) semaphore(_semaphore)->acquire_n(semaphore(_semaphore), _cnt, _timeout, NULL)
+#define _semaphore_acquire_n_4(_semaphore, _cnt, _timeout, _with_config) semaphore(_semaphore)->acquire_n(semaphore(_semaphore), _cnt, _timeout, _with_config)
+//</editor-fold>
 
 // getter, setter
 #define semaphore_permits_cnt(_semaphore) action_signal_unhandled_trigger_count(_semaphore)
@@ -78,6 +87,12 @@ struct Semaphore {
     signal_t (*acquire)(Semaphore_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config);
     // non-blocking action enqueue - trigger if permit is available, trigger on signal otherwise
     signal_t (*acquire_async)(Semaphore_t *_this, Action_t *action);
+    // non-blocking acquire of 'cnt' permits at once
+    signal_t (*try_acquire_n)(Semaphore_t *_this, uint16_t cnt);
+    // acquire 'cnt' permits at once or block until all of them are available, the same semantics as acquire
+    signal_t (*acquire_n)(Semaphore_t *_this, uint16_t cnt, Time_unit_t *timeout, Schedule_config_t *with_config);
+    // add 'cnt' permits at once, wakeup all waiting actions that can be satisfied within single signal handler pass
+    void (*release_n)(Semaphore_t *_this, uint16_t cnt, signal_t signal);
 
 };
 
@@ -87,6 +102,10 @@ struct Semaphore {
  * Initialize semaphore with initial permits count
  *  - if blocking wait on semaphore with timeout is to be used, then 'context' should be default signal processor
  *  to avoid spurious wakeup
+ *  - waiting actions are satisfied strictly in queue order - action at the head of the queue waiting for more permits
+ *  than available blocks the ones behind it, permits are not acquired past waiting actions by try_acquire either
+ *  - once waiting action leaves the queue (timeout, kill, dispose), available permits are passed to the ones behind it
+ *  - blocked process requests number of permits passed to acquire_n(), any other waiting action requests single permit
  */
 void semaphore_register(Semaphore_t *semaphore, uint16_t initial_permits_cnt, Process_control_block_t *context);
 
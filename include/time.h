@@ -24,14 +24,30 @@
  */
 #define TIMING_SUCCESS                                  KERNEL_API_SUCCESS
 #define TIMING_INVALID_STATE                            KERNEL_API_INVALID_STATE
+#define TIMING_INVALID_ARGUMENT                         KERNEL_API_INVALID_ARGUMENT
 #define TIMING_HANDLE_EMPTY                             signal(-1)
 #define TIMING_HANDLE_UNSUPPORTED                       signal(-2)
 #define TIMING_SIGNAL_TIMEOUT                           KERNEL_API_TIMEOUT
 
+#define SECOND_MICROSECONDS                             ((uint32_t) (1000000))
+#define HOUR_SECONDS                                    ((uint32_t) (3600))
+#define HOUR_MICROSECONDS                               ((uint32_t) (HOUR_SECONDS * SECOND_MICROSECONDS))
+
+/**
+ * Periodic timed signal overrun policy - what happens if next trigger time is history when signal handled
+ *  - CATCH_UP - trigger once for each missed period (back-to-back) until caught up, default
+ *  - SKIP - do not trigger for missed periods, realign to next period in future
+ *  - COALESCE - trigger just once for all missed periods, missed count is carried by that trigger
+ *  - interrupt context signals always SKIP, so that timer interrupt service never handles missed periods back-to-back
+ */
+#define TIMED_SIGNAL_OVERRUN_CATCH_UP                   ((uint8_t) 0)
+#define TIMED_SIGNAL_OVERRUN_SKIP                       ((uint8_t) 1)
+#define TIMED_SIGNAL_OVERRUN_COALESCE                   ((uint8_t) 2)
+
 /**
- * Longest supported delay of timed signal (unchecked), approx 3 years
+ * Longest supported delay of timed signal, approx 7 years
  */
-#define MAX_DELAY_HRS                                   ((uint16_t) 0x7F00)
+#define MAX_DELAY_HRS                                   ((uint16_t) 0xFFFF)
 
 /**
  * Timed signal public API access
@@ -39,6 +55,8 @@
 #define timed_signal_create(...) _TIMED_SIGNAL_CREATE_GET_MACRO(__VA_ARGS__, _timed_signal_create_5, _timed_signal_create_4, _timed_signal_create_3, _timed_signal_create_2)(__VA_ARGS__)
 #define timed_signal_set_periodic(_signal, periodic) (timed_signal(_signal)->set_periodic(timed_signal(_signal), periodic))
 #define timed_signal_schedule(_signal) timed_signal(_signal)->schedule(timed_signal(_signal))
+#define timed_signal_schedule_at(_signal, _deadline) timed_signal(_signal)->schedule_at(timed_signal(_signal), _deadline)
+#define timed_interrupt_signal_create(...) _TIMED_INTERRUPT_SIGNAL_CREATE_GET_MACRO(__VA_ARGS__, _timed_interrupt_signal_create_3, _timed_interrupt_signal_create_2)(__VA_ARGS__)
 
 //<editor-fold desc="variable-args - timed_signal_create()">
 #define _TIMED_SIGNAL_CREATE_GET_MACRO(_1,_2,_3,_4,_5,NAME,...) NAME
@@ -53,12 +71,33 @@
 #define _timed_signal_create_5(_signal, _handler, _periodic, _with_config, _context) \
     timed_signal_register(timed_signal(_signal), ((signal_handler_t) (_handler)), _periodic, _with_config, _context)
 //</editor-fold>
+//<editor-fold desc="variable-args - timed_interrupt_signal_create()">
+#define _TIMED_INTERRUPT_SIGNAL_CREATE_GET_MACRO(_1,_2,_3,NAME,...) NAME
+#define _timed_interrupt_signal_create_2(_signal, _handler) \
+    timed_interrupt_signal_register(timed_signal(_signal), ((signal_handler_t) (_handler)), false)
+#define _timed_interrupt_signal_create_3(_signal, _handler, _periodic) \
+    timed_interrupt_signal_register(timed_signal(_signal), ((signal_handler_t) (_handler)), _periodic)
+//</editor-fold>
 
 // getter, setter
-#define timed_signal_trigger_time(_signal) (&(timed_signal(_signal)->_trigger_time))
+// absolute trigger time in usecs since timing start (uint64_t lvalue)
+#define timed_signal_trigger_usecs(_signal) timed_signal(_signal)->_trigger_time
+// fill given time unit by absolute trigger time
+#define timed_signal_trigger_time(_signal, _target) time_unit_from_usecs(_target, timed_signal_trigger_usecs(_signal))
 #define timed_signal_delay(_signal) (&(timed_signal(_signal)->delay))
+#define timed_signal_slack(_signal) (timed_signal(_signal)->slack)
+#define timed_signal_set_slack_usecs(_signal, usecs) timed_signal(_signal)->slack = (uint32_t) (usecs)
+#define timed_signal_set_overrun_policy(_signal, _policy) timed_signal(_signal)->overrun_policy = (_policy)
+#define timed_signal_on_overrun(_signal) timed_signal(_signal)->on_overrun
+// number of periods missed before current trigger (SKIP) / merged into current trigger (COALESCE)
+#define timed_signal_missed_count(_signal) (timed_signal(_signal)->_missed_cnt)
 #define timed_signal_is_periodic(_signal) (timed_signal(_signal)->_periodic)
+#define timed_signal_is_interrupt_context(_signal) (timed_signal(_signal)->_interrupt_context)
 #define timed_signal_trigger_count(_signal) action_signal_unhandled_trigger_count(_signal)
+#ifdef __TIMING_STATISTICS_ENABLE__
+#define timed_signal_statistics(_signal) (&(timed_signal(_signal)->_statistics))
+#define timing_lateness_mean(_lateness) ((_lateness)->cnt ? (uint32_t) ((_lateness)->sum / (_lateness)->cnt) : 0)
+#endif
 
 #define timed_signal_set_delay_from(_signal, hrs, secs, millisecs, usecs) time_unit_from(timed_signal_delay(_signal), hrs, secs, millisecs, usecs)
 // (signal, usecs) -> signal.delay, (signal, secs, usecs) -> signal.delay
@@ -100,11 +139,44 @@
 // -------------------------------------------------------------------------------------
 
 typedef struct Timed_signal Timed_signal_t;
+typedef struct Timing_channel Timing_channel_t;
+
+#ifdef __TIMING_STATISTICS_ENABLE__
+
+/**
+ * Lateness of timed signal relative to it's trigger time in usecs, saturated to 32 bits
+ */
+typedef struct Timing_lateness {
+    uint32_t min;
+    uint32_t max;
+    // sum of all samples, {@see timing_lateness_mean()}
+    uint64_t sum;
+    // number of samples
+    uint32_t cnt;
+
+} Timing_lateness_t;
+
+/**
+ * Timed signal lateness statistics
+ */
+typedef struct Timing_statistics {
+    // signal passed to execution context (or handler executed if interrupt context signal)
+    Timing_lateness_t trigger;
+    // signal handler started within execution context
+    Timing_lateness_t handler;
+    // number of whole periods that had passed before periodic signal was triggered
+    uint32_t missed_period_cnt;
+
+} Timing_statistics_t;
+
+#endif
 
 /**
  * Time unit with granularity of 1 usecond, range 0 - 2^16 hours (max value ~ 7 years), usage:
- *  - absolute time holder - either current time or timed signal trigger time ({@see get_current_time()})
+ *  - absolute time holder - either current time or time of upcoming event ({@see get_current_time()})
  *  - time difference holder - ({@see time_unit_from()})
+ *  - timing works internally with 64-bit monotonic time in usecs, time unit is just API representation
+ *  - time unit passed as timeout is always delay, deadline of blocking call is passed by timeout_until() instead
  */
 struct Time_unit {
     // number of microseconds, never exceeds 3600 * 1000 * 1000
@@ -122,18 +194,39 @@ struct Timed_signal {
     Action_signal_t _signalable;
 
     // -------- state --------
-    // absolute time when action shall be triggered
-    Time_unit_t _trigger_time;
+    // absolute time when action shall be triggered, usecs since timing start
+    uint64_t _trigger_time;
     // delay since timed signal scheduled / delay between triggers if periodic
     Time_unit_t delay;
+    // number of usecs the signal may be triggered late, so that it can share timer interrupt with other signals
+    uint32_t slack;
     // reschedule with given delay on trigger if periodic
     bool _periodic;
+    // handler executed directly within timer interrupt service
+    bool _interrupt_context;
+    // timer channel the signal was scheduled on, chosen by slack on each schedule
+    Timing_channel_t *_channel;
+    // periods missed due to overrun, {@see timed_signal_missed_count()}
+    uint32_t _missed_cnt;
+#ifdef __TIMING_STATISTICS_ENABLE__
+    // lateness statistics of this signal
+    Timing_statistics_t _statistics;
+#endif
 
     // -------- public --------
     // set whether signal suppose to be triggered periodically
     signal_t (*set_periodic)(Timed_signal_t *_this, bool periodic);
     // schedule / reschedule signal to be triggered after preset delay
     signal_t (*schedule)(Timed_signal_t *_this);
+    // schedule / reschedule signal to be triggered at given absolute time, periodic signal keeps delay as period
+    signal_t (*schedule_at)(Timed_signal_t *_this, Time_unit_t *deadline);
+    // what happens if periodic signal misses next period, TIMED_SIGNAL_OVERRUN_CATCH_UP by default (ignored and
+    // TIMED_SIGNAL_OVERRUN_SKIP applied if interrupt context signal)
+    uint8_t overrun_policy;
+    // optional, called with interrupts disabled when next trigger time of periodic signal is history already,
+    // given number of periods that passed (no matter overrun policy) - called within timer interrupt service if
+    // interrupt context signal, it must be short and must not block then (the same as the handler)
+    void (*on_overrun)(Timed_signal_t *_this, uint32_t missed_cnt);
 
 };
 
@@ -143,6 +236,15 @@ struct Timed_signal {
 *  - the delay must be set at least once, helper macros timed_signal_set_delay_*() can be used for this purpose
 *  - periodic signal has constant (preset) delay between triggers no matter what current overhead of timing or scheduler is
 *    - it is automatically rescheduled after handled, next trigger time = last trigger time + delay
+*  - if periodic signal handler (or anything before it) overruns, the overrun policy decides whether missed periods are
+ * triggered back-to-back, skipped or coalesced into single trigger
+*  - optional slack lets the timing subsystem trigger signal up to 'slack' usecs late, signals whose
+ * [trigger_time, trigger_time + slack] windows overlap are triggered from single timer compare interrupt
+*  - timed_signal_schedule_at() takes absolute deadline (current time + delay), which avoids drift of loops that
+ * would otherwise compute 'period - elapsed', if deadline is history already, then signal is triggered right away
+ * without being placed to timing queue and TIMING_SIGNAL_TIMEOUT is returned
+*  - absolute time is only valid while timing is active (get_current_time() returns true), otherwise
+ * timed_signal_schedule_at() returns TIMING_INVALID_STATE - use set_track_current_time() if in doubt
 *  - the public API of timed signal (release, schedule, set periodic) can be used anytime, even from handler itself
 *  - signal handler receives two parameters - signal owner (signal itself by default) and TIMING_SIGNAL_TIMEOUT
 *  - timed signal can be seen as standard action and used that way, e.g. it can be triggered from multiple sources
@@ -154,6 +256,27 @@ struct Timed_signal {
 void timed_signal_register(Timed_signal_t *signal, signal_handler_t handler, bool periodic,
         Schedule_config_t *with_config, Process_control_block_t *context);
 
+/**
+ * Initialize timed signal, the handler of which is executed directly within timer interrupt service
+*  - no signal processor and no context switch involved, handler receives signal owner and TIMING_SIGNAL_TIMEOUT
+ * with interrupts disabled, therefore it must be short, must not block and its return value is ignored
+*  - interrupt context signals are kept in separate sorted list (O(n) schedule), that is checked before standard
+ * timed signals, slack does not apply to them
+*  - signal which is too close to be set as timer compare value is waited for within interrupt service, signal that
+ * is due (or too close) when scheduled is left to interrupt service as well - timer interrupt is requested right away
+*  - each signal is handled at most once per timer interrupt, periodic signal is rescheduled for next timer compare
+*  - periodic signal must have non-zero delay, schedule and set_periodic(true) return TIMING_INVALID_ARGUMENT otherwise
+ */
+void timed_interrupt_signal_register(Timed_signal_t *signal, signal_handler_t handler, bool periodic);
+
+/**
+ * Schedule given signal to given absolute deadline the same way as timed_signal_schedule_at(), but just return
+ * TIMING_SIGNAL_TIMEOUT without triggering the signal if deadline is history already
+ *  - called by suspend() on deadline given by timeout_until() (sleep_until()), so that expired deadline costs
+ * neither pending queue insert nor signal processor wakeup
+ */
+signal_t timed_signal_schedule_deadline(Timed_signal_t *signal, Time_unit_t *deadline);
+
 // -------------------------------------------------------------------------------------
 
 /**
@@ -162,12 +285,44 @@ void timed_signal_register(Timed_signal_t *signal, signal_handler_t handler, boo
  */
 Time_unit_t *time_unit_from(Time_unit_t *time_unit, uint16_t hrs, uint16_t secs, uint16_t millisecs, uint32_t usecs);
 
+#ifdef __GNUC__
+// folded at compile time if all amounts are constant expressions (e.g. timed_signal_set_delay_millisecs(&signal, 250))
+#define time_unit_from(_time_unit, _hrs, _secs, _millisecs, _usecs) \
+    (__builtin_constant_p(_time_unit_usecs_of(_secs, _millisecs, _usecs)) ? _time_unit_from_constant(_time_unit, _hrs, \
+            _time_unit_usecs_of(_secs, _millisecs, _usecs)) : time_unit_from(_time_unit, _hrs, _secs, _millisecs, _usecs))
+
+#define _time_unit_usecs_of(_secs, _millisecs, _usecs) \
+    ((((uint32_t) ((((uint32_t) (_secs)) * 1000) + (_millisecs))) * 1000) + (_usecs))
+#define _time_unit_from_constant(_time_unit, _hrs, _total_usecs) ( \
+    (_time_unit)->hrs = (uint16_t) ((_hrs) + ((_total_usecs) > HOUR_MICROSECONDS)), \
+    (_time_unit)->usecs = (_total_usecs) - ((_total_usecs) > HOUR_MICROSECONDS ? HOUR_MICROSECONDS : 0), \
+    (_time_unit))
+#endif
+
+/**
+ * Fill given 'target' by given absolute time in usecs since timing start and return it
+ *  - conversion by reciprocal multiplication, no 64-bit division
+ */
+Time_unit_t *time_unit_from_usecs(Time_unit_t *target, uint64_t usecs);
+
+/**
+ * Add given time difference 'delta' to 'target' (e.g. deadline of next period) and return it
+ */
+Time_unit_t *time_unit_add(Time_unit_t *target, Time_unit_t *delta);
+
 /**
  * Fill given 'target' structure by current absolute time
 *  - if no timed signals are scheduled and time tracking is not enabled, then just return false
+*  - absolute time is kept by default timing channel, time tracking requests apply to it as well
  */
 bool get_current_time(Time_unit_t *target);
 
+/**
+ * Kernel internal - fill given 'target' by current absolute time in usecs, no conversion to time unit
+ *  - the same as get_current_time() otherwise
+ */
+bool get_current_usecs(uint64_t *target);
+
 /**
  * Enable / disable current time tracking so that get_current_time() always returns true, but timing handle is kept active
  * even when no timed signals are scheduled, which usually results in increased power consumption
@@ -185,6 +340,52 @@ void set_track_current_time(bool track);
  */
 bool get_upcoming_event_time(Time_unit_t *target);
 
+/**
+ * Number of timer compare interrupts saved so far by triggering signals with overlapping slack windows at once
+ */
+uint32_t get_coalesced_interrupt_count();
+
+/**
+ * Number of timed signals (timeouts, periodic reschedules) placed to timing queue right away within critical section
+ * of the caller, which saved context switch to timing queue processor
+ *  - insert is done right away if it takes O(1) - to timing wheel (beyond next timer compare increment) or to either
+ * end of upcoming signal queue, sorted insert in between is still deferred to timing queue processor
+ */
+uint32_t get_avoided_switch_count();
+
+#ifndef __TIMING_BUSY_WAIT_DISABLE__
+
+/**
+ * Spin on timer counter of default timing channel for given delay and return true if the delay is shorter than
+ * busy-wait threshold, return false right away otherwise (and if current time can not be read)
+ *  - time tracking is requested for the whole spin, so that timer is not stopped meanwhile
+ *  - called by suspend_timed() (usleep(), sleep()...) with interrupts enabled, running process is kept runnable
+ *  - threshold is __TIMING_BUSY_WAIT_THRESHOLD__, but at least the time it takes to set timer compare value
+ */
+bool timing_busy_wait(Time_unit_t *delay);
+
+#endif
+
+#ifdef __TIMING_STATISTICS_ENABLE__
+
+/**
+ * Fill given 'target' structure by lateness statistics of all timed signals
+ */
+void get_timing_statistics(Timing_statistics_t *target);
+
+/**
+ * Reset given statistics (e.g. timed_signal_statistics(&signal)), global statistics if NULL
+ */
+void timing_statistics_reset(Timing_statistics_t *statistics);
+
+/**
+ * Record lateness of timed signal handler start, called by wait() right before given signal handler is executed,
+ * ignored if the signal is not timed signal triggered by timing
+ */
+void timing_signal_handler_start(Action_signal_t *signal);
+
+#endif
+
 // -------------------------------------------------------------------------------------
 
 /**
@@ -202,13 +403,27 @@ typedef struct Timing_handle {
     uint32_t _timer_compare_value_set_threshold;
     // timer counter content that corresponds to _current_time_last_stable - fix to (possible) inaccuracy in ticks_to_usecs()
     uint32_t _timer_counter_last_stable;
+    // fixed-point reciprocal conversion generated from timer_frequency_hz, value * multiplier >> shift
+    uint32_t _ticks_to_usecs_multiplier;
+    uint32_t _usecs_to_ticks_multiplier;
+    uint8_t _ticks_to_usecs_shift;
+    uint8_t _usecs_to_ticks_shift;
+#ifndef __TIMING_BUSY_WAIT_DISABLE__
+    // timed suspend with shorter delay (usecs) is busy-waited, set on timing reinit
+    uint32_t _busy_wait_threshold;
+#endif
 
     // -------- public --------
-    // conversion functions, assume 1 us == 1 tick if not set
+    // conversion functions, generated from timer_frequency_hz if not set (and left NULL), 1 us == 1 tick if neither set
     uint32_t (*ticks_to_usecs)(uint32_t ticks);
     uint32_t (*usecs_to_ticks)(uint32_t us);
+    // timer clock frequency, conversion by multiplication only - ticks -> usecs never below exact value and less than
+    // 1 + ticks / 2^_ticks_to_usecs_shift above, usecs -> ticks rounded up the same way (e.g. 32768 Hz: shift 27, 32)
+    uint32_t timer_frequency_hz;
     // counter bit width, accepted range 8 - 32
     uint8_t timer_counter_bit_width;
+    // index of timing channel this handle drives, 0 (default channel) if not set
+    uint8_t timing_channel;
 
 } Timing_handle_t;
 
@@ -218,6 +433,12 @@ typedef struct Timing_handle {
  *  - if resource management is enabled then persistent state can be reset no more that once after system start
  *  - current time is not persistent and setting time to specific value is not supported
  *  - can also be called anytime while system is running to change the handle
+ *  - handle is registered to channel given by handle->timing_channel (up to __TIMING_CHANNEL_CNT__), each channel has
+ * it's own timed signal queues and programs it's own timer compare register, the default channel (0) must be
+ * registered first and it's persistent state reset resets the shared state as well
+ *  - timed signal is routed on schedule to the channel with the coarsest resolution (timer tick) not exceeding
+ * signal slack, to the finest channel if there is no such, e.g. a 32 kHz low-power timer shall take signals with
+ * slack of at least 31 usecs while the rest goes to fast timer
  */
 signal_t timing_reinit(Timing_handle_t *handle, Process_control_block_t *timing_queue_processor, bool persistent_state_reset);
 
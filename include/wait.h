@@ -0,0 +1,117 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ *  Blocking wait for any / all of multiple events, semaphores and process exits
+ *
+ *  Copyright (c) 2018-2019 Mutant Industries ltd.
+ */
+
+#ifndef _SYS_WAIT_H_
+#define _SYS_WAIT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <defs.h>
+#include <action.h>
+#include <scheduler.h>
+
+// -------------------------------------------------------------------------------------
+
+#define wait_node(_node) ((Wait_node_t *) (_node))
+
+/**
+ * Wait node public API access
+ *  - typical usage:
+ *    Wait_node_t nodes[2];
+ *    wait_node_create(&nodes[0], WAIT_NODE_EVENT, &rx_event);
+ *    wait_node_create(&nodes[1], WAIT_NODE_SEMAPHORE, &tx_semaphore);
+ *    ...
+ *    result = wait_any(nodes, 2, timeout_millisecs(100));
+ */
+#define wait_node_create(_node, _type, _object) wait_node_register(wait_node(_node), _type, (void *) (_object))
+#define wait_any(...) _WAIT_ANY_GET_MACRO(__VA_ARGS__, _wait_any_4, _wait_any_3, _wait_any_2)(__VA_ARGS__)
+#define wait_all(...) _WAIT_ALL_GET_MACRO(__VA_ARGS__, _wait_all_4, _wait_all_3, _wait_all_2)(__VA_ARGS__)
+
+//<editor-fold desc="variable-args - wait_any()">
+#define _WAIT_ANY_GET_MACRO(_1,_2,_3,_4,NAME,...) NAME
+#define _wait_any_2(_nodes, _cnt) wait_multiple(_nodes, _cnt, false, NULL, NULL)
+#define _wait_any_3(_nodes, _cnt, _timeout) wait_multiple(_nodes, _cnt, false, _timeout, NULL)
+#define _wait_any_4(_nodes, _cnt, _timeout, _with_config) wait_multiple(_nodes, _cnt, false, _timeout, _with_config)
+//</editor-fold>
+//<editor-fold desc="variable-args - wait_all()">
+#define _WAIT_ALL_GET_MACRO(_1,_2,_3,_4,NAME,...) NAME
+#define _wait_all_2(_nodes, _cnt) wait_multiple(_nodes, _cnt, true, NULL, NULL)
+#define _wait_all_3(_nodes, _cnt, _timeout) wait_multiple(_nodes, _cnt, true, _timeout, NULL)
+#define _wait_all_4(_nodes, _cnt, _timeout, _with_config) wait_multiple(_nodes, _cnt, true, _timeout, _with_config)
+//</editor-fold>
+
+// getter, setter
+// whether object of given node fired within last wait_multiple()
+#define wait_node_fired(_node) wait_node(_node)->_fired
+// signal the object of given node fired with (event signal, semaphore signal, process exit code)
+#define wait_node_signal(_node) wait_node(_node)->_signal
+// index of node returned by successful wait_multiple()
+#define wait_index(_result) ((uint8_t) (intptr_t) (_result))
+
+/**
+ * Wait node object types
+ */
+#define WAIT_NODE_EVENT             ((uint8_t) 0x01)
+#define WAIT_NODE_SEMAPHORE         ((uint8_t) 0x02)
+#define WAIT_NODE_PROCESS           ((uint8_t) 0x03)
+
+/**
+ * Wait API return codes, index of fired node is returned on success
+ */
+#define WAIT_INVALID_ARGUMENT       KERNEL_API_INVALID_ARGUMENT
+#define WAIT_TIMEOUT                KERNEL_API_TIMEOUT
+
+// -------------------------------------------------------------------------------------
+
+typedef struct Wait_node Wait_node_t;
+
+/**
+ * Wait node - lightweight action linked to waitable object queue instead of waiting process
+ */
+struct Wait_node {
+    // resource, placed to subscription list / semaphore queue / process exit action queue while waiting
+    Action_t _triggerable;
+    // event, semaphore or process
+    void *_object;
+    // WAIT_NODE_EVENT, WAIT_NODE_SEMAPHORE or WAIT_NODE_PROCESS
+    uint8_t _type;
+
+    // -------- state --------
+    // wait the node is armed for, NULL if not waiting
+    struct Wait_multiple *_waiter;
+    // position within node array passed to wait_multiple()
+    uint8_t _index;
+    // object fired while armed
+    bool _fired;
+    // signal the object fired with
+    signal_t _signal;
+
+};
+
+/**
+ * Initialize wait node of given object, the node can be passed to wait_multiple() repeatedly
+ *  - the node is resource owned by creating process, it is only linked to object while wait_multiple() is running
+ */
+void wait_node_register(Wait_node_t *node, uint8_t type, void *object);
+
+/**
+ * Blocking wait for any (or all if 'wait_all') objects of given nodes, running process is suspended at most once and
+ * woken up at most once - by the node that completes the wait or by timeout
+ *  - each node is linked to queue of it's object with priority of running process (after 'with_config' applied),
+ * so that priority inheritance of the objects works the same way as if the process waited for them directly
+ *  - event fires on trigger, semaphore fires when permit is acquired, process fires on exit
+ *  - return index of the node that completed the wait - the first one that fired (any) or the last one (all), return
+ * WAIT_TIMEOUT on timeout, WAIT_INVALID_ARGUMENT if 'cnt' is 0 or node type is unknown
+ *  - node signal is the signal the object fired with, disposed objects fire with their disposed signal
+ *  - permits of semaphores acquired by nodes that did not complete the wait are signaled back - all except returned
+ * node in 'any' mode, all on timeout - so that acquired permits are only kept when the wait succeeds
+ *  - 'all' mode acquires semaphore permits one at a time as they become available, not atomically
+ */
+signal_t wait_multiple(Wait_node_t *nodes, uint8_t cnt, bool wait_all, Time_unit_t *timeout, Schedule_config_t *with_config);
+
+
+#endif /* _SYS_WAIT_H_ */
@@ -59,13 +59,18 @@ void action_default_release(Action_t *action) {
 
 // -------------------------------------------------------------------------------------
 
+#ifndef __ACTION_PRIORITY_REQUEST_CNT__
+#define __ACTION_PRIORITY_REQUEST_CNT__         4
+#endif
+
 typedef struct action_set_priority_request {
     Action_t *action;
     priority_t priority;
 
 } action_set_priority_request_t;
 
-static volatile action_set_priority_request_t _recursive_set_priority_request;
+static volatile action_set_priority_request_t _recursive_set_priority_request[__ACTION_PRIORITY_REQUEST_CNT__];
+static uint8_t _recursive_set_priority_request_cnt;
 static bool _recursion_guard;
 
 bool action_default_set_priority(Action_t *action, priority_t priority) {
@@ -80,25 +85,27 @@ bool action_default_set_priority(Action_t *action, priority_t priority) {
         if ( ! _recursion_guard) {
             // this point reached just once in a single call
             _recursion_guard = true;
-            // prepare empty request
-            _recursive_set_priority_request.action = NULL;
+            // prepare empty request stack
+            _recursive_set_priority_request_cnt = 0;
 
             // execute priority change, which might initiate recursive call of this function
             highest_priority_placement = queue->_set_action_priority(action, priority, queue);
 
-            while (_recursive_set_priority_request.action) {
-                // process (possible) recursive calls
-                action = _recursive_set_priority_request.action;
-                priority = _recursive_set_priority_request.priority;
-
-                // break if no more recursive calls are made
-                _recursive_set_priority_request.action = NULL;
-
-                // queue is always set if this point reached
-                queue = action_queue(deque_item_container(action));
-
-                // execute priority change, which might initiate another recursive call of this function
-                queue->_set_action_priority(action, priority, queue);
+            while (_recursive_set_priority_request_cnt) {
+                // process (possible) recursive calls, the last one first
+                _recursive_set_priority_request_cnt--;
+
+                action = _recursive_set_priority_request[_recursive_set_priority_request_cnt].action;
+                priority = _recursive_set_priority_request[_recursive_set_priority_request_cnt].priority;
+
+                // request might be outdated - action released from queue in the meantime
+                if ((queue = action_queue(deque_item_container(action)))) {
+                    // execute priority change, which might initiate another recursive call of this function
+                    queue->_set_action_priority(action, priority, queue);
+                }
+                else {
+                    sorted_set_item_priority(action) = priority;
+                }
             }
 
             // recursive call end
@@ -107,10 +114,16 @@ bool action_default_set_priority(Action_t *action, priority_t priority) {
             // in case priority of some process was changed inside recursive call
             context_switch_trigger();
         }
-        else {
+        else if (_recursive_set_priority_request_cnt < __ACTION_PRIORITY_REQUEST_CNT__) {
             // recursive call - just store request and return (stack usage optimization)
-            _recursive_set_priority_request.action = action;
-            _recursive_set_priority_request.priority = priority;
+            _recursive_set_priority_request[_recursive_set_priority_request_cnt].action = action;
+            _recursive_set_priority_request[_recursive_set_priority_request_cnt].priority = priority;
+
+            _recursive_set_priority_request_cnt++;
+        }
+        else {
+            // no more space for requests, execute priority change right away at the cost of stack usage
+            queue->_set_action_priority(action, priority, queue);
         }
     }
     else {
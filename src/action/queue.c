@@ -78,6 +78,10 @@ static void _release(Action_t *action) {
     if (action_on_released(action)) {
         action_released_callback(action, queue);
     }
+
+    if (queue->_on_released) {
+        queue->_on_released(queue->_owner, action, queue);
+    }
 }
 
 static void _release_sorted(Action_t *action) {
@@ -103,6 +107,10 @@ static void _release_sorted(Action_t *action) {
             queue->_on_head_priority_changed(queue->_owner, queue->_head_priority, queue);
         }
     }
+
+    if (queue->_on_released) {
+        queue->_on_released(queue->_owner, action, queue);
+    }
 }
 
 // -------------------------------------------------------------------------------------
@@ -277,6 +285,122 @@ static void _close(Action_queue_t *_this, signal_t signal) {
     }
 }
 
+// -------------------------------------------------------------------------------------
+// assume interrupts are disabled already
+
+static void _release_detached(Action_t *action) {
+    // action is on its way between queues, on_released hook was triggered already
+    deque_item_remove(deque_item(action));
+}
+
+static void _head_priority_update(Action_queue_t *_this) {
+    priority_t head_priority = action_queue_is_empty(_this) ? 0 : sorted_set_item_priority(action_queue_head(_this));
+
+    if (head_priority != _this->_head_priority) {
+        _this->_head_priority = head_priority;
+
+        if (_this->_on_head_priority_changed) {
+            _this->_on_head_priority_changed(_this->_owner, _this->_head_priority, _this);
+        }
+    }
+}
+
+void action_queue_transfer(Action_queue_t *target, Action_queue_t *source, Action_t *last) {
+    Action_queue_t detached, notified, *pending = &detached;
+    Action_t *current, *cursor;
+    priority_t previous_priority = PRIORITY_RESET;
+    bool last_reached = false;
+
+    // sanity check
+    if (target == source) {
+        return;
+    }
+
+    interrupt_suspend();
+
+    // temporary chain of actions on their way to target, released silently if inserted elsewhere within hooks
+    action_queue_create(&detached, false);
+    detached._release = _release_detached;
+
+    // detach head segment of source, notify each action as if it was released
+    while ( ! last_reached && (current = action_queue_head(source))) {
+        last_reached = current == last;
+
+        if (source->_iterator == current) {
+            _iterator_advance(source);
+        }
+
+        deque_insert_last(deque(&detached), deque_item(current));
+
+        if (action_on_released(current)) {
+            action_released_callback(current, source);
+        }
+    }
+
+    // source is final now, single head priority update
+    if (source->_release == _release_sorted) {
+        _head_priority_update(source);
+    }
+
+    // notify source owner of each action as if it was released, before target is touched
+    if (source->_on_released) {
+        action_queue_create(&notified, false);
+        notified._release = _release_detached;
+
+        while ((current = action_queue_head(pending))) {
+            deque_insert_last(deque(&notified), deque_item(current));
+
+            source->_on_released(source->_owner, current, source);
+        }
+
+        pending = &notified;
+    }
+
+    cursor = action_queue_head(target);
+
+    // link detached actions to target, cursor only moves forward as long as detached chain is sorted
+    while ((current = action_queue_head(pending))) {
+        deque_item_remove(deque_item(current));
+
+        // thread-safety check
+        if (action_queue_is_closed(target)) {
+            continue;
+        }
+
+        if (target->_release != _release_sorted) {
+            deque_insert_last(deque(target), deque_item(current));
+
+            continue;
+        }
+
+        // detached chain not sorted (FIFO source or reordered during trigger_all()), start over
+        if (sorted_set_item_priority(current) > previous_priority) {
+            cursor = action_queue_head(target);
+        }
+
+        // place behind the last action with higher or equal priority
+        while (cursor && sorted_set_item_priority(cursor) >= sorted_set_item_priority(current)) {
+            cursor = action(deque_item_next(cursor)) == action_queue_head(target) ? NULL : action(deque_item_next(cursor));
+        }
+
+        if (cursor) {
+            deque_insert_before(deque_item(current), deque_item(cursor));
+        }
+        else {
+            deque_insert_last(deque(target), deque_item(current));
+        }
+
+        previous_priority = sorted_set_item_priority(current);
+    }
+
+    // single head priority update of target
+    if (target->_release == _release_sorted) {
+        _head_priority_update(target);
+    }
+
+    interrupt_restore();
+}
+
 // -------------------------------------------------------------------------------------
 
 // Action_queue_t constructor
@@ -286,6 +410,7 @@ void action_queue_init(Action_queue_t *queue, bool sorted, bool strict_sorting,
     queue->_head = NULL;
     queue->_owner = owner;
     queue->_on_head_priority_changed = on_head_priority_changed;
+    queue->_on_released = NULL;
 
     // state
     queue->_iterator = NULL;
@@ -17,6 +17,16 @@ static void _on_signal_released(Action_signal_t *_this, Action_queue_t *origin)
         return;
     }
 
+#ifdef __SIGNAL_PAYLOAD_FIFO_ENABLE__
+    if (action_signal_payload_fifo(_this)) {
+        // released after last payload was handled or released by user - all stored payloads are discarded
+        signal_fifo_cnt(action_signal_payload_fifo(_this)) = 0;
+        action_signal_unhandled_trigger_count(_this) = 0;
+
+        return;
+    }
+#endif
+
     // signal handler execution started or signal was released by user
     action_signal_unhandled_trigger_count(_this)--;
 }
@@ -28,6 +38,18 @@ static bool _on_signal_handled(Action_signal_t *_this) {
         return false;
     }
 
+#ifdef __SIGNAL_PAYLOAD_FIFO_ENABLE__
+    Signal_fifo_t *fifo;
+
+    if ((fifo = action_signal_payload_fifo(_this)) && fifo->_cnt) {
+        // pass the oldest stored payload to next handler execution
+        action_signal_input(_this) = fifo->_buffer[fifo->_head];
+
+        fifo->_head = fifo->_head + 1 == fifo->_capacity ? 0 : fifo->_head + 1;
+        fifo->_cnt--;
+    }
+#endif
+
     action_signal_unhandled_trigger_count(_this)--;
 
     // signal is still in pending queue, stay if triggered more times than handled
@@ -51,6 +73,10 @@ void action_signal_register(Action_signal_t *signal, dispose_function_t dispose_
     action_signal_unhandled_trigger_count(signal) = 0;
     // reset signal to be passed to handler
     action_signal_input(signal) = NULL;
+#ifdef __SIGNAL_PAYLOAD_FIFO_ENABLE__
+    // only the last signal is passed to handler by default
+    action_signal_payload_fifo(signal) = NULL;
+#endif
     // set default on_handled hook
     action_signal_on_handled(signal) = _on_signal_handled;
     // set default on_released hook to ensure signal._unhandled_trigger_count is consistent
@@ -67,6 +93,63 @@ void action_signal_register(Action_signal_t *signal, dispose_function_t dispose_
     }
 }
 
+#ifdef __SIGNAL_PAYLOAD_FIFO_ENABLE__
+
+// Signal_fifo_t constructor
+signal_t signal_fifo_register(Signal_fifo_t *fifo, signal_t *buffer, uint16_t capacity, uint8_t overflow_policy) {
+
+    // sanity check
+    if ( ! capacity || (overflow_policy != SIGNAL_FIFO_DROP_OLDEST && overflow_policy != SIGNAL_FIFO_DROP_NEWEST)) {
+        return SIGNAL_FIFO_INVALID_ARGUMENT;
+    }
+
+    fifo->_buffer = buffer;
+    fifo->_capacity = capacity;
+    fifo->_overflow_policy = overflow_policy;
+
+    // state
+    fifo->_head = 0;
+    fifo->_cnt = 0;
+    fifo->_high_water_mark = 0;
+    fifo->_overflow_cnt = 0;
+
+    return SIGNAL_FIFO_SUCCESS;
+}
+
+// return true if number of stored payloads increased
+static bool _signal_fifo_push(Signal_fifo_t *fifo, signal_t signal) {
+    uint16_t index;
+
+    if (fifo->_cnt == fifo->_capacity) {
+        fifo->_overflow_cnt++;
+
+        if (fifo->_overflow_policy == SIGNAL_FIFO_DROP_NEWEST) {
+            return false;
+        }
+
+        // new payload takes place of the oldest one, number of stored payloads does not change
+        fifo->_buffer[fifo->_head] = signal;
+        fifo->_head = fifo->_head + 1 == fifo->_capacity ? 0 : fifo->_head + 1;
+
+        return false;
+    }
+
+    // index behind the newest stored payload, no modulo
+    if ((index = fifo->_head + fifo->_cnt) >= fifo->_capacity) {
+        index -= fifo->_capacity;
+    }
+
+    fifo->_buffer[index] = signal;
+
+    if (++fifo->_cnt > fifo->_high_water_mark) {
+        fifo->_high_water_mark = fifo->_cnt;
+    }
+
+    return true;
+}
+
+#endif /* __SIGNAL_PAYLOAD_FIFO_ENABLE__ */
+
 // -------------------------------------------------------------------------------------
 
 void signal_trigger(Action_signal_t *_this, signal_t signal) {
@@ -74,6 +157,21 @@ void signal_trigger(Action_signal_t *_this, signal_t signal) {
 
     interrupt_suspend();
 
+#ifdef __SIGNAL_PAYLOAD_FIFO_ENABLE__
+    // payload to be passed to handler is set already if signal is pending - store the new one behind it
+    if (action_signal_payload_fifo(_this) && action_signal_unhandled_trigger_count(_this)) {
+
+        // signal shall be handled once more unless payload was lost on overflow
+        if (_signal_fifo_push(action_signal_payload_fifo(_this), signal)) {
+            action_signal_unhandled_trigger_count(_this)++;
+        }
+
+        interrupt_restore();
+
+        return;
+    }
+#endif
+
     // store signal to be passed to event dispatcher
     action_signal_input(_this) = signal;
 
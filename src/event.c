@@ -7,13 +7,61 @@
 #include <process.h>
 
 
+static void _event_list_dispatch(Event_t *_this, Action_queue_t *list, signal_t signal) {
+    // list of outer dispatch if nested by event_trigger_sync() within subscription
+    Action_queue_t *dispatched_list = _this->_dispatched_list;
+
+    // make list available to event_stop_propagation()
+    _this->_dispatched_list = list;
+    // trigger all list subscriptions
+    action_queue_trigger_all(list, signal);
+
+    _this->_dispatched_list = dispatched_list;
+}
+
 static bool _event_dispatch(Event_t *_this, signal_t signal) {
+    // propagation state of outer dispatch if nested by event_trigger_sync() within subscription
+    bool propagation_stopped = _this->_propagation_stopped;
+    Event_topic_t *topic;
+
+    _this->_propagation_stopped = false;
+
+    // topic index is sorted by key_min, no topic behind first one with key_min beyond signal can match
+    for (topic = _this->_topic_index; topic && topic->_key_min <= (intptr_t) signal
+            && ! _this->_propagation_stopped; topic = topic->_next) {
+
+        if ((intptr_t) signal <= topic->_key_max) {
+            _event_list_dispatch(_this, &topic->_subscription_list, signal);
+        }
+    }
+
     // trigger all event subscriptions
-    action_queue_trigger_all(&_this->_subscription_list, signal);
+    if ( ! _this->_propagation_stopped) {
+        _event_list_dispatch(_this, &_this->_subscription_list, signal);
+    }
+
+    // nested dispatch does not affect outer one
+    _this->_propagation_stopped = propagation_stopped;
+
     // stay in waiting loop
     return true;
 }
 
+static void _event_subscription_priority_changed(Event_t *_this, priority_t priority, Action_queue_t *origin) {
+    Event_topic_t *topic;
+
+    // inherit highest head priority of event and all topic subscription lists
+    priority = action_queue_get_head_priority(&_this->_subscription_list);
+
+    for (topic = _this->_topic_index; topic; topic = topic->_next) {
+        if (action_queue_get_head_priority(&topic->_subscription_list) > priority) {
+            priority = action_queue_get_head_priority(&topic->_subscription_list);
+        }
+    }
+
+    signal_set_priority(action_signal(_this), priority);
+}
+
 // -------------------------------------------------------------------------------------
 
 static signal_t _event_subscribe(Event_t *_this, Action_t *action) {
@@ -29,6 +77,19 @@ static signal_t _event_subscribe(Event_t *_this, Action_t *action) {
     return EVENT_SUCCESS;
 }
 
+static signal_t _event_topic_subscribe(Event_topic_t *_this, Action_t *action) {
+
+    // sanity check
+    if (action == action(running_process)) {
+        return EVENT_INVALID_ARGUMENT;
+    }
+
+    // just insert action to topic subscription list
+    action_queue_insert(&_this->_subscription_list, action);
+
+    return EVENT_SUCCESS;
+}
+
 static signal_t _event_wait(Event_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config) {
 
     interrupt_suspend();
@@ -41,22 +102,111 @@ static signal_t _event_wait(Event_t *_this, Time_unit_t *timeout, Schedule_confi
     return running_process->blocked_state_signal;
 }
 
+static bool _event_is_subscribed(Event_t *_this) {
+    // interrupts are disabled already
+    Event_topic_t *topic;
+
+    if ( ! action_queue_is_empty(&_this->_subscription_list)) {
+        return true;
+    }
+
+    for (topic = _this->_topic_index; topic; topic = topic->_next) {
+        if ( ! action_queue_is_empty(&topic->_subscription_list)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Return true if trigger shall be passed to execution context right away
+ */
+static bool _event_filter_pass(Event_filter_t *_this, signal_t signal) {
+    // interrupts are disabled already
+    bool window_open = deque_item_container(&_this->_window) != NULL;
+
+    if (_this->_mode == EVENT_FILTER_DEBOUNCE) {
+        if (window_open) {
+            _this->_suppressed_cnt++;
+
+            return false;
+        }
+
+        // leading edge - open window and deliver, delivered anyway if window cannot be opened
+        timed_signal_schedule(&_this->_window);
+
+        return true;
+    }
+
+    if (window_open) {
+        // merged with previous trigger
+        _this->_suppressed_cnt++;
+    }
+
+    _this->_last_signal = signal;
+    _this->_trigger_cnt++;
+
+    // (re)start window since the last trigger
+    if (timed_signal_schedule(&_this->_window) == TIMING_SUCCESS) {
+        return false;
+    }
+
+    // window cannot be opened, deliver right away
+    _this->_coalesced_cnt = _this->_trigger_cnt;
+    _this->_trigger_cnt = 0;
+
+    return true;
+}
+
+static bool _event_filter_window_passed(Event_filter_t *_this, signal_t signal) {
+    // interrupts are disabled already (interrupt context timed signal)
+
+    if (_this->_mode == EVENT_FILTER_COALESCE && _this->_trigger_cnt) {
+        // trailing edge - deliver the last signal with number of merged triggers
+        _this->_coalesced_cnt = _this->_trigger_cnt;
+        _this->_trigger_cnt = 0;
+
+        if (_event_is_subscribed(_this->_event)) {
+            signal_trigger(action_signal(_this->_event), _this->_last_signal);
+        }
+    }
+
+    return true;
+}
+
 static void _event_trigger(Event_t *_this, signal_t signal) {
 
     interrupt_suspend();
 
-    // only trigger if subscription list is not empty
-    if ( ! action_queue_is_empty(&_this->_subscription_list)) {
+    // only trigger if any subscription list is not empty, filter might defer or drop the trigger
+    if (_event_is_subscribed(_this) && ( ! _this->_filter || _event_filter_pass(_this->_filter, signal))) {
         signal_trigger(action_signal(_this), signal);
     }
 
     interrupt_restore();
 }
 
+void event_stop_propagation(Event_t *event) {
+
+    interrupt_suspend();
+
+    if (event->_dispatched_list) {
+        // no more actions of currently dispatched list are triggered
+        event->_dispatched_list->_iterator = NULL;
+        // no more lists are dispatched
+        event->_propagation_stopped = true;
+        event->_dispatched_list = NULL;
+    }
+
+    interrupt_restore();
+}
+
 // -------------------------------------------------------------------------------------
 
 // Event_t destructor
 static dispose_function_t _event_dispose(Event_t *_this) {
+    Event_topic_t *topic;
 
     // do nothing on subscribe and disable blocking wait
     _this->wait = (signal_t (*)(Event_t *, Time_unit_t *, Schedule_config_t *)) unsupported_after_disposed;
@@ -68,6 +218,18 @@ static dispose_function_t _event_dispose(Event_t *_this) {
     // close subscription list with disposed signal
     action_queue_close(&_this->_subscription_list, EVENT_DISPOSED);
 
+    // the same applies to all topics
+    for (topic = _this->_topic_index; topic; topic = topic->_next) {
+        topic->subscribe = (signal_t (*)(Event_topic_t *, Action_t *)) unsupported_after_disposed;
+        action_queue_on_head_priority_changed(&topic->_subscription_list) = NULL;
+        action_queue_close(&topic->_subscription_list, EVENT_DISPOSED);
+    }
+
+    // no more deferred triggers
+    if (_this->_filter) {
+        action_release(&_this->_filter->_window);
+    }
+
     return NULL;
 }
 
@@ -81,9 +243,79 @@ void event_register(Event_t *event, Schedule_config_t *with_config, Process_cont
     action(event)->trigger = (action_trigger_t) _event_trigger;
 
     // inherit priority of subscription list and schedule config, init dummy trigger setter
-    action_queue_create(&event->_subscription_list, true, false, event, signal_set_priority);
+    action_queue_create(&event->_subscription_list, true, false, event, _event_subscription_priority_changed);
+
+    // no topics, no filter
+    event->_topic_index = NULL;
+    event->_filter = NULL;
+    // state
+    event->_dispatched_list = NULL;
+    event->_propagation_stopped = false;
 
     // public
     event->subscribe = _event_subscribe;
     event->wait = _event_wait;
 }
+
+// Event_topic_t constructor
+signal_t event_topic_register(Event_topic_t *topic, Event_t *event, intptr_t key_min, intptr_t key_max) {
+    Event_topic_t **position;
+
+    // sanity check
+    if (key_min > key_max) {
+        return EVENT_INVALID_ARGUMENT;
+    }
+
+    // event priority is inherited from topic subscription list as well
+    action_queue_create(&topic->_subscription_list, true, false, event, _event_subscription_priority_changed);
+
+    topic->_event = event;
+    topic->_key_min = key_min;
+    topic->_key_max = key_max;
+
+    // public
+    topic->subscribe = _event_topic_subscribe;
+
+    interrupt_suspend();
+
+    // keep topic index sorted by key_min, topics with the same key_min are dispatched in order of registration
+    for (position = &event->_topic_index; *position && (*position)->_key_min <= key_min; position = &(*position)->_next);
+
+    topic->_next = *position;
+    *position = topic;
+
+    interrupt_restore();
+
+    return EVENT_SUCCESS;
+}
+
+// Event_filter_t constructor
+signal_t event_filter_register(Event_filter_t *filter, Event_t *event, uint8_t mode, uint32_t window_usecs) {
+
+    // sanity check
+    if ((mode != EVENT_FILTER_DEBOUNCE && mode != EVENT_FILTER_COALESCE) || ! window_usecs) {
+        return EVENT_INVALID_ARGUMENT;
+    }
+
+    // window handler executed within timer interrupt service, no context switch when window passes
+    timed_interrupt_signal_create(&filter->_window, _event_filter_window_passed);
+    action_owner(&filter->_window) = filter;
+    timed_signal_set_delay_usecs(&filter->_window, window_usecs);
+
+    filter->_event = event;
+    filter->_mode = mode;
+
+    // state
+    filter->_last_signal = NULL;
+    filter->_trigger_cnt = 0;
+    filter->_coalesced_cnt = 1;
+    filter->_suppressed_cnt = 0;
+
+    interrupt_suspend();
+
+    event->_filter = filter;
+
+    interrupt_restore();
+
+    return EVENT_SUCCESS;
+}
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2018-2019 Mutant Industries ltd.
+#include <pool.h>
+#include <driver/interrupt.h>
+
+
+// item header lookup, item always immediately follows its header
+#define _item_header(_item) ((Pool_item_header_t *) (_item) - 1)
+#define _header_item(_header) ((void *) ((Pool_item_header_t *) (_header) + 1))
+// head of item dispose chain - first member of every disposable structure
+#define _item_dispose_chain_head(_item) ((Dispose_hook_t *) (_item))->_dispose_hook
+
+// -------------------------------------------------------------------------------------
+
+static dispose_function_t _pool_item_disposed(void *item) {
+    // item was returned to pool already, nothing to be done
+    return NULL;
+}
+
+static dispose_function_t _pool_item_dispose(void *item) {
+    Pool_item_header_t *header = _item_header(item);
+    dispose_function_t dispose_hook = header->_dispose_hook;
+
+    // execute original dispose chain first, item must not be reused while it is being disposed
+    while (dispose_hook) {
+        dispose_hook = (dispose_function_t) dispose_hook(item);
+    }
+
+    interrupt_suspend();
+
+    // disable repeated release on repeated dispose
+    _item_dispose_chain_head(item) = (dispose_function_t) _pool_item_disposed;
+    header->_dispose_hook = NULL;
+
+    pool_item_release(item);
+
+    interrupt_restore();
+
+    return NULL;
+}
+
+// -------------------------------------------------------------------------------------
+
+void *pool_allocate(Pool_t *pool) {
+    Pool_item_header_t *header;
+
+    interrupt_suspend();
+
+    if ((header = pool->_free_list)) {
+        pool->_free_list = header->_next;
+        header->_next = NULL;
+        // item is in use from now on
+        header->_pool = pool;
+
+        if (++pool->_allocated_cnt > pool->_high_water_mark) {
+            pool->_high_water_mark = pool->_allocated_cnt;
+        }
+    }
+    else {
+        pool->_failed_alloc_cnt++;
+    }
+
+    interrupt_restore();
+
+    return header ? _header_item(header) : NULL;
+}
+
+signal_t pool_item_release(void *item) {
+    Pool_item_header_t *header = _item_header(item);
+    Pool_t *pool;
+
+    interrupt_suspend();
+
+    // item was released already (released twice or released after dispose)
+    if ( ! (pool = header->_pool)) {
+        interrupt_restore();
+
+        return POOL_ITEM_RELEASED;
+    }
+
+    header->_pool = NULL;
+    header->_next = pool->_free_list;
+    pool->_free_list = header;
+
+    pool->_allocated_cnt--;
+
+    interrupt_restore();
+
+    return POOL_SUCCESS;
+}
+
+void pool_item_dispose_bind(void *item) {
+    Pool_item_header_t *header = _item_header(item);
+
+    interrupt_suspend();
+
+    // store original dispose chain and place pool release on its top
+    header->_dispose_hook = _item_dispose_chain_head(item);
+    _item_dispose_chain_head(item) = (dispose_function_t) _pool_item_dispose;
+
+    interrupt_restore();
+}
+
+// -------------------------------------------------------------------------------------
+
+// Pool_t constructor
+signal_t pool_register(Pool_t *pool, void *blocks, uint16_t block_size, uint16_t capacity, uint16_t item_offset) {
+    Pool_item_header_t *header;
+    uint16_t i;
+
+    // sanity check
+    if (item_offset != sizeof(Pool_item_header_t)) {
+        return POOL_INVALID_ARGUMENT;
+    }
+
+    pool->_free_list = NULL;
+
+    // chain all blocks, first block becomes head of free list
+    for (i = capacity; i > 0; i--) {
+        header = (Pool_item_header_t *) ((uint8_t *) blocks + (i - 1) * block_size);
+
+        header->_pool = NULL;
+        header->_dispose_hook = NULL;
+        header->_next = pool->_free_list;
+
+        pool->_free_list = header;
+    }
+
+    // state
+    pool->_allocated_cnt = 0;
+    pool->_high_water_mark = 0;
+    pool->_failed_alloc_cnt = 0;
+    pool->_capacity = capacity;
+
+    return POOL_SUCCESS;
+}
@@ -4,6 +4,7 @@
 #include <stddef.h>
 #include <driver/interrupt.h>
 #include <driver/stack.h>
+#include <sync/mutex.h>
 #ifdef __PROCESS_LOCAL_WDT_CONFIG__
 #include <driver/wdt.h>
 #endif
@@ -30,6 +31,9 @@ static dispose_function_t _process_dispose(Process_control_block_t *_this) {
     }
 #endif
 
+    // mutexes held without contention are released the same way as the rest of on_exit actions
+    mutex_held_list_link(_this);
+
     // disable priority inheritance from on_exit_action_queue
     action_queue_on_head_priority_changed(&_this->on_exit_action_queue) = NULL;
 
@@ -99,6 +103,7 @@ void process_register(Process_control_block_t *process, Process_create_config_t
 
     // reset action queues, inherit their priority
     action_queue_create(&process->on_exit_action_queue, true, true, process, schedulable_state_reset);
+    process->_held_mutex_list = NULL;
     action_queue_create(&process->pending_signal_queue, true, true, process, schedulable_state_reset);
 
 #ifndef __SIGNAL_PROCESSOR_DISABLE__
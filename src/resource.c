@@ -11,6 +11,41 @@
  */
 #ifdef __RESOURCE_MANAGEMENT_ENABLE__
 
+// resource detached from its owner by resource_owner_transfer(), still within resource dispose chain
+#define _resource_detached(_resource) ((_resource)->_prev == (_resource))
+
+static void _resource_list_unlink(Disposable_t *resource) {
+    // interrupts are disabled already
+
+    // first item on list check
+    if (resource->_owner->_resource_list == resource) {
+        resource->_owner->_resource_list = resource->_owner->_resource_list->_next;
+    }
+
+    // remove from list
+    if (resource->_prev) {
+        resource->_prev->_next = resource->_next;
+    }
+
+    if (resource->_next) {
+        resource->_next->_prev = resource->_prev;
+    }
+}
+
+static void _resource_list_link(Process_control_block_t *owner, Disposable_t *resource) {
+    // interrupts are disabled already
+
+    resource->_owner = owner;
+    resource->_prev = NULL;
+    resource->_next = owner->_resource_list;
+
+    if (owner->_resource_list) {
+        owner->_resource_list->_prev = resource;
+    }
+
+    owner->_resource_list = resource;
+}
+
 /**
  * This point reached on dispose() if process_mark_resource was called before
  */
@@ -19,23 +54,14 @@ static dispose_function_t _resource_list_remove(Disposable_t *resource) {
 
     interrupt_suspend();
 
-    if (resource && resource->_owner) {
-        // first item on list check
-        if (resource->_owner->_resource_list == resource) {
-            resource->_owner->_resource_list = resource->_owner->_resource_list->_next;
-        }
-
-        // remove from list
-        if (resource->_prev) {
-            resource->_prev->_next = resource->_next;
-        }
-
-        if (resource->_next) {
-            resource->_next->_prev = resource->_prev;
+    if (resource && (resource->_owner || _resource_detached(resource))) {
+        if (resource->_owner) {
+            _resource_list_unlink(resource);
         }
 
         // optimization - when the same resource is marked again, _resource_list_remove shall not be called
         resource->_owner = NULL;
+        resource->_prev = NULL;
 
         // return parent dispose hook
         result = resource->_dispose_hook;
@@ -54,6 +80,7 @@ void resource_mark(Process_control_block_t *owner, Disposable_t *resource, dispo
         // resource shall not be released on process exit, but the dispose feature shall be preserved
         resource->_resource_dispose_hook._dispose_hook = dispose_hook;
         resource->_owner = NULL;
+        resource->_prev = NULL;
 
         return;
     }
@@ -63,20 +90,36 @@ void resource_mark(Process_control_block_t *owner, Disposable_t *resource, dispo
         _resource_list_remove(resource);
     }
 
-    resource->_owner = owner;
     resource->_resource_dispose_hook._dispose_hook = (dispose_function_t) _resource_list_remove;
     resource->_dispose_hook = dispose_hook;
-    resource->_prev = NULL;
 
     interrupt_suspend();
 
-    resource->_next = owner->_resource_list;
+    _resource_list_link(owner, resource);
 
-    if (owner->_resource_list) {
-        owner->_resource_list->_prev = resource;
-    }
+    interrupt_restore();
+}
 
-    owner->_resource_list = resource;
+void resource_owner_transfer(Process_control_block_t *owner, Disposable_t *resource) {
+
+    interrupt_suspend();
+
+    // resource that is not owned by any process is not going to be released on process exit, keep it that way
+    if (resource->_owner ? resource->_owner != owner : owner && _resource_detached(resource)) {
+
+        if (resource->_owner) {
+            _resource_list_unlink(resource);
+        }
+
+        if (owner) {
+            _resource_list_link(owner, resource);
+        }
+        else {
+            // not released on exit of any process until transferred again, dispose chain is kept
+            resource->_owner = NULL;
+            resource->_prev = resource;
+        }
+    }
 
     interrupt_restore();
 }
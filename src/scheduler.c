@@ -114,6 +114,9 @@ void schedulable_state_reset(Process_control_block_t *process, priority_t priori
 
 signal_t wait(Time_unit_t *timeout, Schedule_config_t *with_config) {
     Time_unit_t wait_timeout;
+#ifndef __SIGNAL_PROCESSOR_DISABLE__
+    bool deadline = timeout && timeout_is_deadline(timeout);
+#endif
 
     if (timeout) {
         // store timeout so that source structure can be modified within signal handlers
@@ -145,6 +148,11 @@ signal_t wait(Time_unit_t *timeout, Schedule_config_t *with_config) {
                 process_schedule_config(running_process)->priority = sorted_set_item_priority(signal);
             }
 
+#ifdef __TIMING_STATISTICS_ENABLE__
+            // lateness of timed signal handler start
+            timing_signal_handler_start(signal);
+#endif
+
             // execute action handler, process waiting state depends on handler return value
             process_waiting(running_process) = action(signal)->handler(action_owner(signal), action_signal_input(signal));
 
@@ -175,7 +183,12 @@ signal_t wait(Time_unit_t *timeout, Schedule_config_t *with_config) {
 
         // once again check whether process is still waiting - might be reset in schedule_handler (timeout)
         if (process_waiting(running_process) && action_queue_is_empty(&running_process->pending_signal_queue)) {
+#ifndef __SIGNAL_PROCESSOR_DISABLE__
+            // deadline might have been overwritten by blocking call within signal handler
+            suspend(TIMING_SIGNAL_TIMEOUT, NULL, deadline ? timeout_until(timeout) : timeout, with_config);
+#else
             suspend(TIMING_SIGNAL_TIMEOUT, NULL, timeout, with_config);
+#endif
         }
 
         interrupt_restore();
@@ -197,16 +210,31 @@ signal_t suspend(signal_t blocked_state_condition, Action_queue_t *queue, Time_u
     if (blocked_state_condition != KERNEL_API_SUCCESS && blocked_state_condition != KERNEL_DISPOSED_RESOURCE_ACCESS) {
 
 #ifndef __SIGNAL_PROCESSOR_DISABLE__
+        signal_t timed_schedule_result = TIMING_SUCCESS;
+
+        if (timeout && timeout_is_deadline(timeout)) {
+            // absolute deadline given by timeout_until(), nothing is triggered if it is history already
+            timed_schedule_result = timed_signal_schedule_deadline(&running_process->timed_schedule, timeout);
+        }
         // store process timed schedule delay if set
-        if (timeout) {
+        else if (timeout) {
             time_unit_copy(timeout, timed_signal_delay(&running_process->timed_schedule));
+
+            // try to set process timed schedule, check whether timing is initialized
+            timed_schedule_result = timed_signal_schedule(&running_process->timed_schedule);
         }
 
-        // try to set process timed schedule, check whether timing is initialized
-        if (timeout && timed_signal_schedule(&running_process->timed_schedule) == TIMING_INVALID_STATE) {
+        if (timed_schedule_result == TIMING_INVALID_STATE) {
             // invalid state, requested operation not possible
             running_process->blocked_state_signal = TIMING_INVALID_STATE;
         }
+        else if (timed_schedule_result == TIMING_SIGNAL_TIMEOUT) {
+            // deadline is history already, timed schedule was not set, no need to suspend
+
+            // timeout breaks wait loop the same way as triggered timed schedule does
+            process_waiting(running_process) = false;
+            running_process->blocked_state_signal = TIMING_SIGNAL_TIMEOUT;
+        }
 #else
         if (timeout) {
             // invalid state, requested operation not possible
@@ -237,6 +265,21 @@ signal_t suspend(signal_t blocked_state_condition, Action_queue_t *queue, Time_u
     return running_process->blocked_state_signal;
 }
 
+signal_t suspend_timed(Time_unit_t *timeout, Schedule_config_t *with_config) {
+
+#if ! defined(__SIGNAL_PROCESSOR_DISABLE__) && ! defined(__TIMING_BUSY_WAIT_DISABLE__)
+    // delay shorter than timed suspend itself is busy-waited with interrupts enabled, no need to suspend
+    if (timeout && ! timeout_is_deadline(timeout) && timing_busy_wait(timeout)) {
+        // store / reset schedule config
+        schedule_config_copy(with_config, process_schedule_config(running_process));
+
+        return running_process->blocked_state_signal = TIMING_SIGNAL_TIMEOUT;
+    }
+#endif
+
+    return suspend(TIMING_SIGNAL_TIMEOUT, NULL, timeout, with_config);
+}
+
 // -------------------------------------------------------------------------------------
 
 inline void context_switch_trigger() {
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2018-2019 Mutant Industries ltd.
+#include <sync/barrier.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <driver/interrupt.h>
+#include <process.h>
+
+
+static bool _barrier_arrive(Barrier_t *_this) {
+    // interrupts are disabled already
+
+    if (++_this->_arrived_cnt < _this->_parties) {
+        return false;
+    }
+
+    // last arrival - reset for next cycle
+    _this->_arrived_cnt = 0;
+    _this->_generation++;
+
+    // single wakeup of all waiting parties
+    action_queue_trigger_all(&_this->_queue, BARRIER_SUCCESS);
+
+    return true;
+}
+
+static signal_t _barrier_wait(Barrier_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config) {
+    signal_t result;
+    uint16_t generation;
+
+    interrupt_suspend();
+
+    generation = _this->_generation;
+
+    if (_barrier_arrive(_this)) {
+        // last arrival is not blocked, possible priority shift if config set
+        suspend(BARRIER_SUCCESS, NULL, NULL, with_config);
+
+        interrupt_restore();
+
+        return BARRIER_SERIAL;
+    }
+
+    // suspend running process until barrier trips, apply given config
+    suspend(BARRIER_WAIT_TIMEOUT, &_this->_queue, timeout, with_config);
+
+    interrupt_restore();
+
+    // process resumed here
+    interrupt_suspend();
+
+    if ((result = running_process->blocked_state_signal) != BARRIER_SUCCESS && result != BARRIER_DISPOSED) {
+        if (generation == _this->_generation) {
+            // withdraw arrival
+            _this->_arrived_cnt--;
+        }
+        else {
+            // barrier tripped before timed out process was resumed, its arrival was counted
+            result = BARRIER_SUCCESS;
+        }
+    }
+
+    interrupt_restore();
+
+    return result;
+}
+
+static void _barrier_trigger(Barrier_t *_this, signal_t signal) {
+
+    interrupt_suspend();
+
+    _barrier_arrive(_this);
+
+    interrupt_restore();
+}
+
+// -------------------------------------------------------------------------------------
+
+static signal_t _latch_wait(Latch_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config) {
+
+    interrupt_suspend();
+    // suspend running process if count did not reach zero yet, apply given config
+    suspend(_this->_cnt ? LATCH_WAIT_TIMEOUT : LATCH_SUCCESS, &_this->_queue, timeout, with_config);
+
+    interrupt_restore();
+
+    return running_process->blocked_state_signal;
+}
+
+static void _latch_trigger(Latch_t *_this, signal_t signal) {
+
+    interrupt_suspend();
+
+    if (_this->_cnt && ! --_this->_cnt) {
+        // single wakeup of all waiting processes
+        action_queue_trigger_all(&_this->_queue, LATCH_SUCCESS);
+    }
+
+    interrupt_restore();
+}
+
+// -------------------------------------------------------------------------------------
+
+// Barrier_t destructor
+static dispose_function_t _barrier_dispose(Barrier_t *_this) {
+
+    _this->wait = (signal_t (*)(Barrier_t *, Time_unit_t *, Schedule_config_t *)) unsupported_after_disposed;
+
+    action_queue_close(&_this->_queue, BARRIER_DISPOSED);
+
+    return NULL;
+}
+
+// Barrier_t constructor
+void barrier_register(Barrier_t *barrier, uint16_t parties) {
+
+    action_create(barrier, (dispose_function_t) _barrier_dispose, _barrier_trigger);
+    // initialize barrier queue, no sorting needed since all processes are woken up at once
+    action_queue_create(&barrier->_queue, false);
+
+    barrier->_parties = parties;
+
+    // state
+    barrier->_arrived_cnt = 0;
+    barrier->_generation = 0;
+
+    // public
+    barrier->wait = _barrier_wait;
+}
+
+// Latch_t destructor
+static dispose_function_t _latch_dispose(Latch_t *_this) {
+
+    _this->wait = (signal_t (*)(Latch_t *, Time_unit_t *, Schedule_config_t *)) unsupported_after_disposed;
+
+    action_queue_close(&_this->_queue, LATCH_DISPOSED);
+
+    return NULL;
+}
+
+// Latch_t constructor
+void latch_register(Latch_t *latch, uint16_t cnt) {
+
+    action_create(latch, (dispose_function_t) _latch_dispose, _latch_trigger);
+    // initialize latch queue, no sorting needed since all processes are woken up at once
+    action_queue_create(&latch->_queue, false);
+
+    // state
+    latch->_cnt = cnt;
+
+    // public
+    latch->wait = _latch_wait;
+}
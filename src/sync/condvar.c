@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2018-2019 Mutant Industries ltd.
+#include <sync/condvar.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <driver/interrupt.h>
+#include <process.h>
+
+
+static signal_t _wait(Condvar_t *_this, Mutex_t *mutex, Time_unit_t *timeout, Schedule_config_t *with_config) {
+    signal_t result;
+    uint16_t nesting_cnt;
+
+    interrupt_suspend();
+
+    if (mutex_owner(mutex) != running_process) {
+        interrupt_restore();
+
+        return CONDVAR_INVALID_OWNER;
+    }
+
+    if ( ! action_queue_is_empty(&_this->_queue) && _this->_mutex != mutex) {
+        interrupt_restore();
+
+        return CONDVAR_INVALID_ARGUMENT;
+    }
+
+    _this->_mutex = mutex;
+
+    // release mutex completely, wakeup next process waiting for it
+    nesting_cnt = mutex_nesting_cnt(mutex);
+    mutex_nesting_cnt(mutex) = 1;
+    mutex_unlock(mutex);
+
+    // no window between unlock and enqueue - interrupts are still disabled
+    suspend(CONDVAR_WAIT_TIMEOUT, &_this->_queue, timeout, with_config);
+
+    interrupt_restore();
+
+    // process resumed here - either signaled and owning mutex already, or timed out / disposed
+    result = running_process->blocked_state_signal;
+
+    if (mutex_owner(mutex) != running_process) {
+        // acquire mutex the standard way with the same config
+        if (mutex_lock(mutex, NULL, with_config) != MUTEX_SUCCESS) {
+            return CONDVAR_DISPOSED;
+        }
+    }
+    else if (result == MUTEX_SUCCESS) {
+        result = CONDVAR_SUCCESS;
+    }
+
+    // mutex is held with the original nesting count again
+    mutex_nesting_cnt(mutex) = nesting_cnt;
+
+    return result;
+}
+
+static void _signal(Condvar_t *_this, signal_t signal) {
+    Process_control_block_t *process;
+
+    interrupt_suspend();
+
+    // move first waiting process to mutex queue
+    if ((process = process(action_queue_pop(&_this->_queue)))) {
+        mutex_requeue(_this->_mutex, process);
+    }
+
+    interrupt_restore();
+}
+
+static void _broadcast(Condvar_t *_this) {
+    Process_control_block_t *process;
+
+    interrupt_suspend();
+
+    // move all waiting processes to mutex queue, first one is woken up right away if mutex is not locked
+    while ((process = process(action_queue_pop(&_this->_queue)))) {
+        mutex_requeue(_this->_mutex, process);
+    }
+
+    interrupt_restore();
+}
+
+// -------------------------------------------------------------------------------------
+
+// Condvar_t destructor
+static dispose_function_t _condvar_dispose(Condvar_t *_this) {
+
+    _this->wait = (signal_t (*)(Condvar_t *, Mutex_t *, Time_unit_t *, Schedule_config_t *)) unsupported_after_disposed;
+    _this->broadcast = (void (*)(Condvar_t *)) unsupported_after_disposed;
+
+    // wakeup all waiting processes, they acquire mutex before wait returns
+    action_queue_close(&_this->_queue, CONDVAR_DISPOSED);
+
+    return NULL;
+}
+
+// Condvar_t constructor
+void condvar_register(Condvar_t *condvar) {
+
+    action_create(condvar, (dispose_function_t) _condvar_dispose, _signal);
+    // initialize condition variable queue sorted by priority
+    action_queue_create(&condvar->_queue, true);
+
+    // state
+    condvar->_mutex = NULL;
+
+    // public
+    condvar->wait = _wait;
+    condvar->broadcast = _broadcast;
+}
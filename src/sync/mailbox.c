@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2018-2019 Mutant Industries ltd.
+#include <sync/mailbox.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <driver/interrupt.h>
+#include <process.h>
+#include <resource.h>
+
+
+// -------------------------------------------------------------------------------------
+
+#ifdef __RESOURCE_MANAGEMENT_ENABLE__
+#define _message_owner_set(_mailbox, _owner, _message) \
+    if ((_mailbox)->_transfer_ownership) { \
+        resource_owner_transfer(_owner, (Disposable_t *) (_message)); \
+    }
+#else
+#define _message_owner_set(_mailbox, _owner, _message)
+#endif
+
+// -------------------------------------------------------------------------------------
+
+static void _push(Mailbox_t *_this, void *message) {
+    // interrupts are disabled already
+    uint16_t tail = _this->_head + _this->_cnt;
+
+    if (tail >= _this->_capacity) {
+        tail -= _this->_capacity;
+    }
+
+    _this->_buffer[tail] = message;
+    _this->_cnt++;
+
+    // stored message is not owned by any process until received, so that it outlives its sender
+    _message_owner_set(_this, NULL, message);
+}
+
+static void *_pop(Mailbox_t *_this) {
+    // interrupts are disabled already
+    void *message = _this->_buffer[_this->_head];
+
+    _this->_head = _this->_head + 1 == _this->_capacity ? 0 : _this->_head + 1;
+    _this->_cnt--;
+
+    return message;
+}
+
+// -------------------------------------------------------------------------------------
+
+static signal_t _try_send(Mailbox_t *_this, void *message) {
+    signal_t result = MAILBOX_SUCCESS;
+    Process_control_block_t *receiver;
+
+    // sanity check
+    if ( ! message) {
+        return MAILBOX_INVALID_ARGUMENT;
+    }
+
+    interrupt_suspend();
+
+    if ((receiver = process(action_queue_pop(&_this->_receiver_queue)))) {
+        // direct handoff - blocked state signal of waiting receiver holds message destination
+        *((void **) receiver->blocked_state_signal) = message;
+
+        _message_owner_set(_this, receiver, message);
+        // wakeup with requested config
+        process_schedule(receiver, MAILBOX_SUCCESS);
+    }
+    else if (_this->_cnt < _this->_capacity) {
+        _push(_this, message);
+    }
+    else {
+        result = MAILBOX_FULL;
+    }
+
+    interrupt_restore();
+
+    return result;
+}
+
+static signal_t _send(Mailbox_t *_this, void *message, Time_unit_t *timeout, Schedule_config_t *with_config) {
+    signal_t result;
+
+    interrupt_suspend();
+
+    if ((result = _try_send(_this, message)) == MAILBOX_INVALID_ARGUMENT) {
+        interrupt_restore();
+
+        return result;
+    }
+
+    if (result == MAILBOX_FULL) {
+        // message is kept in blocked state signal until process is woken up
+        result = signal(message);
+    }
+
+    // suspend running process if mailbox is full, apply given config
+    suspend(result, &_this->_sender_queue, timeout, with_config);
+
+    interrupt_restore();
+
+    return running_process->blocked_state_signal;
+}
+
+static signal_t _try_receive(Mailbox_t *_this, void **message) {
+    signal_t result = MAILBOX_SUCCESS;
+    Process_control_block_t *sender;
+
+    // sanity check
+    if ( ! message) {
+        return MAILBOX_INVALID_ARGUMENT;
+    }
+
+    interrupt_suspend();
+
+    sender = process(action_queue_pop(&_this->_sender_queue));
+
+    if (_this->_cnt) {
+        *message = _pop(_this);
+
+        // space freed, store message of first blocked sender
+        if (sender) {
+            _push(_this, sender->blocked_state_signal);
+        }
+    }
+    else if (sender) {
+        // nothing stored (zero capacity), take message of blocked sender directly
+        *message = sender->blocked_state_signal;
+    }
+    else {
+        result = MAILBOX_EMPTY;
+    }
+
+    if (sender) {
+        process_schedule(sender, MAILBOX_SUCCESS);
+    }
+
+    if (result == MAILBOX_SUCCESS) {
+        _message_owner_set(_this, running_process, *message);
+    }
+
+    interrupt_restore();
+
+    return result;
+}
+
+static signal_t _receive(Mailbox_t *_this, void **message, Time_unit_t *timeout, Schedule_config_t *with_config) {
+    signal_t result;
+
+    interrupt_suspend();
+
+    if ((result = _try_receive(_this, message)) == MAILBOX_INVALID_ARGUMENT) {
+        interrupt_restore();
+
+        return result;
+    }
+
+    if (result == MAILBOX_EMPTY) {
+        // message destination is kept in blocked state signal until process is woken up
+        result = signal(message);
+    }
+
+    // suspend running process if mailbox is empty, apply given config
+    suspend(result, &_this->_receiver_queue, timeout, with_config);
+
+    interrupt_restore();
+
+    return running_process->blocked_state_signal;
+}
+
+// -------------------------------------------------------------------------------------
+
+static void _mailbox_trigger(Mailbox_t *_this, signal_t signal) {
+
+    interrupt_suspend();
+
+    // non-blocking send of signal as message
+    if (_try_send(_this, signal) == MAILBOX_FULL) {
+        _this->_dropped_cnt++;
+    }
+
+    interrupt_restore();
+}
+
+// Mailbox_t destructor
+static dispose_function_t _mailbox_dispose(Mailbox_t *_this) {
+
+    _this->try_send = (signal_t (*)(Mailbox_t *, void *)) unsupported_after_disposed;
+    _this->send = (signal_t (*)(Mailbox_t *, void *, Time_unit_t *, Schedule_config_t *)) unsupported_after_disposed;
+    _this->try_receive = (signal_t (*)(Mailbox_t *, void **)) unsupported_after_disposed;
+    _this->receive = (signal_t (*)(Mailbox_t *, void **, Time_unit_t *, Schedule_config_t *)) unsupported_after_disposed;
+
+    // wakeup all blocked processes, message of blocked sender stays with sender
+    action_queue_close(&_this->_receiver_queue, MAILBOX_DISPOSED);
+    action_queue_close(&_this->_sender_queue, MAILBOX_DISPOSED);
+
+#ifdef __RESOURCE_MANAGEMENT_ENABLE__
+    // reclaim stored messages, no process is going to receive them
+    while (_this->_transfer_ownership && _this->_cnt) {
+        dispose(_pop(_this));
+    }
+#endif
+
+    return NULL;
+}
+
+// Mailbox_t constructor
+void mailbox_register(Mailbox_t *mailbox, void **buffer, uint16_t capacity, bool transfer_ownership) {
+
+    action_create(mailbox, (dispose_function_t) _mailbox_dispose, _mailbox_trigger);
+    // initialize queues sorted by priority
+    action_queue_create(&mailbox->_receiver_queue, true);
+    action_queue_create(&mailbox->_sender_queue, true);
+
+    mailbox->_buffer = buffer;
+    mailbox->_capacity = capacity;
+#ifdef __RESOURCE_MANAGEMENT_ENABLE__
+    mailbox->_transfer_ownership = transfer_ownership;
+#endif
+
+    // state
+    mailbox->_head = 0;
+    mailbox->_cnt = 0;
+    mailbox->_dropped_cnt = 0;
+
+    // public
+    mailbox->try_send = _try_send;
+    mailbox->send = _send;
+    mailbox->try_receive = _try_receive;
+    mailbox->receive = _receive;
+}
@@ -4,35 +4,147 @@
 #include <stddef.h>
 #include <driver/interrupt.h>
 #include <process.h>
+#ifdef __MUTEX_STATISTICS_ENABLE__
+#include <time.h>
+#endif
 
 
 // -------------------------------------------------------------------------------------
 
-#define _owner_attr arg_2
-#define _mutex_owner(_mutex) action_attr(_mutex, _owner_attr)
+#define _mutex_owner(_mutex) mutex_owner(_mutex)
 #define _mutex_lockable(_mutex) (action(_mutex)->trigger == (action_trigger_t) action_default_release)
+#define _mutex_linked(_mutex) (deque_item_container(_mutex) != NULL)
 
 // -------------------------------------------------------------------------------------
 
+#ifdef __MUTEX_STATISTICS_ENABLE__
+
+#define _MUTEX_TIME_UNKNOWN UINT64_MAX
+
+// list of all mutexes, {@see mutex_statistics_snapshot()}
+static Mutex_t *_mutex_list;
+
+/**
+ * Current absolute time in usecs, _MUTEX_TIME_UNKNOWN if timing is not running
+ */
+static uint64_t _mutex_time() {
+    uint64_t now;
+
+    if ( ! get_current_usecs(&now)) {
+        return _MUTEX_TIME_UNKNOWN;
+    }
+
+    return now;
+}
+
+static void _mutex_time_record(uint32_t *cnt, uint64_t *sum, uint32_t *max, uint64_t start, uint64_t end) {
+    uint64_t usecs = end > start ? end - start : 0;
+
+    if (usecs > UINT32_MAX) {
+        usecs = UINT32_MAX;
+    }
+
+    if (usecs > *max) {
+        *max = (uint32_t) usecs;
+    }
+
+    *sum += usecs;
+    (*cnt)++;
+}
+
+static void _mutex_hold_record(Mutex_t *_this) {
+    // interrupts are disabled already
+    uint64_t now;
+
+    if (_this->_acquired_time != _MUTEX_TIME_UNKNOWN && (now = _mutex_time()) != _MUTEX_TIME_UNKNOWN) {
+        _mutex_time_record(&_this->_statistics.hold_cnt, &_this->_statistics.hold_sum, &_this->_statistics.hold_max,
+                _this->_acquired_time, now);
+    }
+
+    _this->_acquired_time = _MUTEX_TIME_UNKNOWN;
+}
+
+static void _mutex_priority_changed(Mutex_t *_this, priority_t priority, Action_queue_t *origin) {
+    // interrupts are disabled already
+
+    if (priority > _this->_statistics.inherited_priority_max) {
+        _this->_statistics.inherited_priority_max = priority;
+    }
+
+    action_default_set_priority(action(_this), priority);
+}
+
+#endif
+
+static void _held_list_remove(Mutex_t *_this) {
+    // interrupts are disabled already
+    Mutex_t **held = &process(_mutex_owner(_this))->_held_mutex_list;
+
+    // mutexes are mostly unlocked in reverse order, so that it is usually the first one
+    while (*held && *held != _this) {
+        held = &(*held)->_next_held;
+    }
+
+    if (*held) {
+        *held = _this->_next_held;
+    }
+}
+
+static void _mutex_link(Mutex_t *_this) {
+    // interrupts are disabled already
+
+    if ( ! _mutex_linked(_this)) {
+        _held_list_remove(_this);
+        // enqueue mutex in owner process on_exit_action_queue, owner process inherit mutex priority
+        action_queue_insert(&process(_mutex_owner(_this))->on_exit_action_queue, _this);
+    }
+}
+
+static void _mutex_grant(Mutex_t *_this, Process_control_block_t *process) {
+    // interrupts are disabled already
+
+    // mark owner
+    _mutex_owner(_this) = process;
+    // locked already, reset nesting count
+    _this->_nesting_cnt = 1;
+#ifdef __MUTEX_STATISTICS_ENABLE__
+    _this->_statistics.acquired_cnt++;
+    _this->_acquired_time = _mutex_time();
+#endif
+    // just record ownership, no need to inherit priority of mutex unless there are waiting processes
+    _this->_next_held = process->_held_mutex_list;
+    process->_held_mutex_list = _this;
+
+    if ( ! action_queue_is_empty(&_this->_queue)) {
+        _mutex_link(_this);
+    }
+}
+
 static void _on_mutex_released(Mutex_t *_this) {
     // interrupts are disabled already
+    Process_control_block_t *process;
 
     // check whether mutex is being disposed
     if ( ! _mutex_lockable(_this)) {
         return;
     }
 
+#ifdef __MUTEX_STATISTICS_ENABLE__
+    _mutex_hold_record(_this);
+#endif
+
     // remove next waiting process if queue not empty, adjust mutex priority
-    if (_mutex_owner(_this) = process(action_queue_pop(&_this->_queue))) {
-        // enqueue mutex in owner process on_exit_action_queue, owner process inherit mutex priority
-        action_queue_insert(&process(_mutex_owner(_this))->on_exit_action_queue, _this);
+    if ((process = process(action_queue_pop(&_this->_queue)))) {
+        _mutex_grant(_this, process);
+#ifdef __MUTEX_STATISTICS_ENABLE__
+        _this->_statistics.contended_cnt++;
+#endif
         // wakeup with requested config
-        process_schedule(_mutex_owner(_this), MUTEX_SUCCESS);
-        // locked already, reset nesting count
-        _this->_nesting_cnt = 1;
+        process_schedule(process, MUTEX_SUCCESS);
     }
     else {
         // reset mutex state variables
+        _mutex_owner(_this) = NULL;
         _this->_nesting_cnt = 0;
     }
 }
@@ -49,12 +161,7 @@ static signal_t _try_lock(Mutex_t *_this) {
         result = MUTEX_DISPOSED;
     }
     else if ( ! _mutex_owner(_this)) {
-        // mark owner
-        _mutex_owner(_this) = running_process;
-        // locked already, reset nesting count
-        _this->_nesting_cnt = 1;
-        // enqueue mutex in owner process on_exit_action_queue, owner process inherit mutex priority
-        action_queue_insert(&process(_mutex_owner(_this))->on_exit_action_queue, _this);
+        _mutex_grant(_this, running_process);
     }
     else if (_mutex_owner(_this) == running_process) {
         _this->_nesting_cnt++;
@@ -69,13 +176,41 @@ static signal_t _try_lock(Mutex_t *_this) {
 }
 
 static signal_t _lock(Mutex_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config) {
+    signal_t result;
+#ifdef __MUTEX_STATISTICS_ENABLE__
+    uint64_t wait_start = _MUTEX_TIME_UNKNOWN;
+#endif
 
     interrupt_suspend();
+
+    if ((result = _try_lock(_this)) == MUTEX_LOCKED) {
+        // contention - owner inherits priority of waiting processes from now on
+        _mutex_link(_this);
+#ifdef __MUTEX_STATISTICS_ENABLE__
+        wait_start = _mutex_time();
+#endif
+    }
+
     // suspend running process if mutex locked, apply given config
-    suspend(_try_lock(_this), &_this->_queue, timeout, with_config);
+    suspend(result, &_this->_queue, timeout, with_config);
 
     interrupt_restore();
 
+#ifdef __MUTEX_STATISTICS_ENABLE__
+    // process resumed here, wait ended when mutex was passed to it
+    if (wait_start != _MUTEX_TIME_UNKNOWN && running_process->blocked_state_signal == MUTEX_SUCCESS) {
+
+        interrupt_suspend();
+
+        if (_this->_acquired_time != _MUTEX_TIME_UNKNOWN) {
+            _mutex_time_record(&_this->_statistics.wait_cnt, &_this->_statistics.wait_sum, &_this->_statistics.wait_max,
+                    wait_start, _this->_acquired_time);
+        }
+
+        interrupt_restore();
+    }
+#endif
+
     return running_process->blocked_state_signal;
 }
 
@@ -89,8 +224,18 @@ static signal_t _unlock(Mutex_t *_this) {
         result = MUTEX_INVALID_OWNER;
     }
     else if ( ! --_this->_nesting_cnt) {
-        // reset mutex and wakeup next process if queue is not empty, initiate context switch
-        action_release(_this);
+        if (_mutex_linked(_this)) {
+            // reset mutex and wakeup next process if queue is not empty, initiate context switch
+            action_release(_this);
+        }
+        else {
+#ifdef __MUTEX_STATISTICS_ENABLE__
+            _mutex_hold_record(_this);
+#endif
+            // nobody is waiting and no priority was inherited, just reset owner
+            _held_list_remove(_this);
+            _mutex_owner(_this) = NULL;
+        }
     }
 
     interrupt_restore();
@@ -98,6 +243,87 @@ static signal_t _unlock(Mutex_t *_this) {
     return result;
 }
 
+void mutex_requeue(Mutex_t *mutex, Process_control_block_t *process) {
+
+    interrupt_suspend();
+
+#ifndef __SIGNAL_PROCESSOR_DISABLE__
+    // timeout of previous blocking state no longer applies, wait for mutex as long as it takes
+    action_release(&process->timed_schedule);
+#endif
+
+    if ( ! _mutex_lockable(mutex)) {
+        process_schedule(process, MUTEX_DISPOSED);
+    }
+    else if ( ! _mutex_owner(mutex)) {
+        _mutex_grant(mutex, process);
+        // wakeup with requested config
+        process_schedule(process, MUTEX_SUCCESS);
+    }
+    else {
+        _mutex_link(mutex);
+        // process stays suspended, woken up by unlock the same way as if it was blocked in mutex_lock()
+        action_queue_insert(&mutex->_queue, process);
+    }
+
+    interrupt_restore();
+}
+
+void mutex_held_list_link(Process_control_block_t *process) {
+
+    interrupt_suspend();
+
+    while (process->_held_mutex_list) {
+        _mutex_link(process->_held_mutex_list);
+    }
+
+    interrupt_restore();
+}
+
+#ifdef __MUTEX_STATISTICS_ENABLE__
+
+uint16_t mutex_statistics_snapshot(Mutex_snapshot_t *target, uint16_t capacity) {
+    uint16_t cnt = 0;
+    Mutex_t *mutex;
+    Action_t *waiting;
+
+    interrupt_suspend();
+
+    for (mutex = _mutex_list; mutex; mutex = mutex->_next_registered, cnt++) {
+        if (cnt < capacity) {
+            target[cnt].mutex = mutex;
+            target[cnt].owner = _mutex_owner(mutex);
+            target[cnt].waiting_cnt = 0;
+            target[cnt].statistics = mutex->_statistics;
+
+            // mutex queue is circular
+            if ((waiting = action_queue_head(&mutex->_queue))) {
+                do {
+                    target[cnt].waiting_cnt++;
+                } while ((waiting = action(deque_item_next(waiting))) != action_queue_head(&mutex->_queue));
+            }
+        }
+    }
+
+    interrupt_restore();
+
+    return cnt;
+}
+
+void mutex_statistics_reset(Mutex_t *mutex) {
+    Mutex_t *current;
+
+    interrupt_suspend();
+
+    for (current = mutex ? mutex : _mutex_list; current; current = mutex ? NULL : current->_next_registered) {
+        zerofill(&current->_statistics);
+    }
+
+    interrupt_restore();
+}
+
+#endif
+
 // -------------------------------------------------------------------------------------
 
 // Mutex_t destructor
@@ -108,6 +334,28 @@ static dispose_function_t _mutex_dispose(Mutex_t *_this) {
     _this->try_lock = (signal_t (*)(Mutex_t *)) unsupported_after_disposed;
     _this->unlock = (signal_t (*)(Mutex_t *)) unsupported_after_disposed;
 
+    interrupt_suspend();
+
+    // owner shall not reach disposed mutex on exit
+    if (_mutex_owner(_this) && ! _mutex_linked(_this)) {
+        _held_list_remove(_this);
+    }
+
+#ifdef __MUTEX_STATISTICS_ENABLE__
+    Mutex_t **registered = &_mutex_list;
+
+    // remove from list of all mutexes
+    while (*registered && *registered != _this) {
+        registered = &(*registered)->_next_registered;
+    }
+
+    if (*registered) {
+        *registered = _this->_next_registered;
+    }
+#endif
+
+    interrupt_restore();
+
     // disable mutex inheriting queue head priority
     action_queue_on_head_priority_changed(&_this->_queue) = NULL;
     // release all waiting processes
@@ -121,11 +369,27 @@ void mutex_register(Mutex_t *mutex) {
 
     action_create(mutex, (dispose_function_t) _mutex_dispose, action_default_release);
     action_on_released(mutex) = (action_released_hook_t) _on_mutex_released;
+#ifdef __MUTEX_STATISTICS_ENABLE__
+    action_queue_create(&mutex->_queue, true, true, mutex, _mutex_priority_changed);
+#else
     action_queue_create(&mutex->_queue, true, true, mutex, action_default_set_priority);
+#endif
     _mutex_owner(mutex) = NULL;
 
     // state
     mutex->_nesting_cnt = 0;
+    mutex->_next_held = NULL;
+#ifdef __MUTEX_STATISTICS_ENABLE__
+    zerofill(&mutex->_statistics);
+    mutex->_acquired_time = _MUTEX_TIME_UNKNOWN;
+
+    interrupt_suspend();
+
+    mutex->_next_registered = _mutex_list;
+    _mutex_list = mutex;
+
+    interrupt_restore();
+#endif
     sorted_set_item_priority(mutex) = 0;
 
     // public
@@ -0,0 +1,333 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2018-2019 Mutant Industries ltd.
+#include <sync/rwlock.h>
+#include <stddef.h>
+#include <driver/interrupt.h>
+#include <process.h>
+
+
+// -------------------------------------------------------------------------------------
+
+#define _owner_attr arg_2
+#define _rwlock_owner(_action) action_attr(_action, _owner_attr)
+#define _rwlock_lockable(_rwlock) (action(_rwlock)->trigger == (action_trigger_t) action_default_release)
+
+// -------------------------------------------------------------------------------------
+
+static RWLock_reader_t *_reader_slot_of(RWLock_t *_this, Process_control_block_t *process) {
+    // interrupts are disabled already
+    uint8_t i;
+
+    for (i = 0; i < _this->_reader_slot_cnt; i++) {
+        if (_rwlock_owner(&_this->_readers[i]) == process) {
+            return &_this->_readers[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void _write_lock_grant(RWLock_t *_this, Process_control_block_t *process) {
+    // interrupts are disabled already
+
+    // mark owner
+    _rwlock_owner(_this) = process;
+    // locked already, reset nesting count
+    _this->_nesting_cnt = 1;
+    // enqueue lock in owner process on_exit_action_queue, owner process inherit lock priority
+    action_queue_insert(&process->on_exit_action_queue, _this);
+}
+
+static bool _read_lock_grant(RWLock_t *_this, Process_control_block_t *process) {
+    // interrupts are disabled already
+    RWLock_reader_t *reader;
+
+    // free slot is the one with no owner
+    if ( ! (reader = _reader_slot_of(_this, NULL))) {
+        return false;
+    }
+
+    _rwlock_owner(reader) = process;
+    reader->_nesting_cnt = 1;
+
+    _this->_reader_cnt++;
+
+    // each reader inherits lock priority the same way as writer does
+    sorted_set_item_priority(reader) = sorted_set_item_priority(_this);
+    action_queue_insert(&process->on_exit_action_queue, reader);
+
+    return true;
+}
+
+/**
+ * Pass released lock to waiting processes
+ */
+static void _rwlock_handoff(RWLock_t *_this) {
+    // interrupts are disabled already
+    Process_control_block_t *process;
+
+    // check whether lock is being disposed or is still locked for writing
+    if ( ! _rwlock_lockable(_this) || _rwlock_owner(_this)) {
+        return;
+    }
+
+    // writer is woken up once there are no readers, first if preferred, if no reader is waiting otherwise
+    if ( ! _this->_reader_cnt && ! action_queue_is_empty(&_this->_writer_queue)
+            && (_this->_writer_preference || action_queue_is_empty(&_this->_reader_queue))) {
+
+        process = process(action_queue_pop(&_this->_writer_queue));
+
+        _write_lock_grant(_this, process);
+        // wakeup with requested config
+        process_schedule(process, RWLOCK_SUCCESS);
+
+        return;
+    }
+
+    // new readers wait for preferred writer
+    if (_this->_writer_preference && ! action_queue_is_empty(&_this->_writer_queue)) {
+        return;
+    }
+
+    // wakeup as many waiting readers as there are free slots
+    while ( ! action_queue_is_empty(&_this->_reader_queue) && _this->_reader_cnt < _this->_reader_slot_cnt) {
+        process = process(action_queue_pop(&_this->_reader_queue));
+
+        _read_lock_grant(_this, process);
+
+        process_schedule(process, RWLOCK_SUCCESS);
+    }
+}
+
+static void _on_write_lock_released(RWLock_t *_this) {
+    // interrupts are disabled already
+
+    _rwlock_owner(_this) = NULL;
+    _this->_nesting_cnt = 0;
+
+    _rwlock_handoff(_this);
+}
+
+static void _on_read_lock_released(RWLock_reader_t *_this) {
+    // interrupts are disabled already
+
+    _rwlock_owner(_this) = NULL;
+    _this->_nesting_cnt = 0;
+
+    _this->_lock->_reader_cnt--;
+
+    _rwlock_handoff(_this->_lock);
+}
+
+static void _on_writer_queue_released(RWLock_t *_this, Action_t *action, Action_queue_t *origin) {
+    // interrupts are disabled already
+
+    // preferred writer timed out or was killed, readers waiting for it might be woken up now
+    _rwlock_handoff(_this);
+}
+
+static void _rwlock_priority_changed(RWLock_t *_this, priority_t priority, Action_queue_t *origin) {
+    // interrupts are disabled already
+    uint8_t i;
+
+    // lock inherits priority of both queues
+    priority = action_queue_get_head_priority(&_this->_writer_queue);
+
+    if (action_queue_get_head_priority(&_this->_reader_queue) > priority) {
+        priority = action_queue_get_head_priority(&_this->_reader_queue);
+    }
+
+    // pass priority to writer (if write locked)
+    action_set_priority(_this, priority);
+
+    // and to all readers, request per each one {@see action_default_set_priority()}
+    for (i = 0; i < _this->_reader_slot_cnt; i++) {
+        if (_rwlock_owner(&_this->_readers[i])) {
+            action_set_priority(&_this->_readers[i], priority);
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------------
+
+static signal_t _try_read_lock(RWLock_t *_this) {
+    signal_t result = RWLOCK_SUCCESS;
+    RWLock_reader_t *reader;
+
+    interrupt_suspend();
+
+    // check whether lock is being disposed
+    if ( ! _rwlock_lockable(_this)) {
+        result = RWLOCK_DISPOSED;
+    }
+    else if (_rwlock_owner(_this) == running_process) {
+        // nested within write lock
+        _this->_nesting_cnt++;
+    }
+    else if ((reader = _reader_slot_of(_this, running_process))) {
+        reader->_nesting_cnt++;
+    }
+    else if (_rwlock_owner(_this) || (_this->_writer_preference && ! action_queue_is_empty(&_this->_writer_queue))
+            || ! _read_lock_grant(_this, running_process)) {
+
+        result = RWLOCK_LOCKED;
+    }
+
+    interrupt_restore();
+
+    return result;
+}
+
+static signal_t _read_lock(RWLock_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config) {
+
+    interrupt_suspend();
+    // suspend running process if lock is not available for reading, apply given config
+    suspend(_try_read_lock(_this), &_this->_reader_queue, timeout, with_config);
+
+    interrupt_restore();
+
+    return running_process->blocked_state_signal;
+}
+
+static signal_t _try_write_lock(RWLock_t *_this) {
+    signal_t result = RWLOCK_SUCCESS;
+
+    interrupt_suspend();
+
+    // check whether lock is being disposed
+    if ( ! _rwlock_lockable(_this)) {
+        result = RWLOCK_DISPOSED;
+    }
+    else if (_rwlock_owner(_this) == running_process) {
+        _this->_nesting_cnt++;
+    }
+    else if (_reader_slot_of(_this, running_process)) {
+        // upgrade would deadlock
+        result = RWLOCK_INVALID_OWNER;
+    }
+    else if (_rwlock_owner(_this) || _this->_reader_cnt) {
+        result = RWLOCK_LOCKED;
+    }
+    else {
+        _write_lock_grant(_this, running_process);
+    }
+
+    interrupt_restore();
+
+    return result;
+}
+
+static signal_t _write_lock(RWLock_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config) {
+    signal_t result;
+
+    interrupt_suspend();
+
+    // only suspend if locked by another process
+    if ((result = _try_write_lock(_this)) == RWLOCK_INVALID_OWNER) {
+        running_process->blocked_state_signal = result;
+    }
+    else {
+        // suspend running process if lock is not available for writing, apply given config
+        suspend(result, &_this->_writer_queue, timeout, with_config);
+    }
+
+    interrupt_restore();
+
+    return running_process->blocked_state_signal;
+}
+
+static signal_t _unlock(RWLock_t *_this) {
+    signal_t result = RWLOCK_SUCCESS;
+    RWLock_reader_t *reader;
+
+    interrupt_suspend();
+
+    if (_rwlock_owner(_this) == running_process) {
+        if ( ! --_this->_nesting_cnt) {
+            // reset lock and wakeup next process(es), initiate context switch
+            action_release(_this);
+        }
+    }
+    else if ((reader = _reader_slot_of(_this, running_process))) {
+        if ( ! --reader->_nesting_cnt) {
+            action_release(reader);
+        }
+    }
+    else {
+        // invalid owner or not locked
+        result = RWLOCK_INVALID_OWNER;
+    }
+
+    interrupt_restore();
+
+    return result;
+}
+
+// -------------------------------------------------------------------------------------
+
+// RWLock_t destructor
+static dispose_function_t _rwlock_dispose(RWLock_t *_this) {
+    uint8_t i;
+
+    // no more processes are going to be queued after this
+    _this->read_lock = (signal_t (*)(RWLock_t *, Time_unit_t *, Schedule_config_t *)) unsupported_after_disposed;
+    _this->write_lock = (signal_t (*)(RWLock_t *, Time_unit_t *, Schedule_config_t *)) unsupported_after_disposed;
+    _this->try_read_lock = (signal_t (*)(RWLock_t *)) unsupported_after_disposed;
+    _this->try_write_lock = (signal_t (*)(RWLock_t *)) unsupported_after_disposed;
+    _this->unlock = (signal_t (*)(RWLock_t *)) unsupported_after_disposed;
+
+    // disable lock inheriting queue head priority
+    action_queue_on_head_priority_changed(&_this->_writer_queue) = NULL;
+    action_queue_on_head_priority_changed(&_this->_reader_queue) = NULL;
+    // no more handoff to waiting processes
+    action_queue_on_released(&_this->_writer_queue) = NULL;
+
+    // release all readers
+    for (i = 0; i < _this->_reader_slot_cnt; i++) {
+        action_release(&_this->_readers[i]);
+    }
+
+    // release all waiting processes
+    action_queue_close(&_this->_writer_queue, RWLOCK_DISPOSED);
+    action_queue_close(&_this->_reader_queue, RWLOCK_DISPOSED);
+
+    return NULL;
+}
+
+// RWLock_t constructor
+void rwlock_register(RWLock_t *rwlock, RWLock_reader_t *readers, uint8_t reader_slot_cnt, bool writer_preference) {
+    uint8_t i;
+
+    action_create(rwlock, (dispose_function_t) _rwlock_dispose, action_default_release);
+    action_on_released(rwlock) = (action_released_hook_t) _on_write_lock_released;
+    action_queue_create(&rwlock->_writer_queue, true, true, rwlock, _rwlock_priority_changed);
+    action_queue_create(&rwlock->_reader_queue, true, true, rwlock, _rwlock_priority_changed);
+    // pass lock on whenever waiting writer leaves the queue other than by handoff
+    action_queue_on_released(&rwlock->_writer_queue) = (action_queue_released_hook_t) _on_writer_queue_released;
+    _rwlock_owner(rwlock) = NULL;
+
+    for (i = 0; i < reader_slot_cnt; i++) {
+        action_create(&readers[i], NULL, action_default_release);
+        action_on_released(&readers[i]) = (action_released_hook_t) _on_read_lock_released;
+        _rwlock_owner(&readers[i]) = NULL;
+
+        readers[i]._lock = rwlock;
+        readers[i]._nesting_cnt = 0;
+    }
+
+    rwlock->_readers = readers;
+    rwlock->_reader_slot_cnt = reader_slot_cnt;
+    rwlock->_writer_preference = writer_preference;
+
+    // state
+    rwlock->_reader_cnt = 0;
+    rwlock->_nesting_cnt = 0;
+    sorted_set_item_priority(rwlock) = 0;
+
+    // public
+    rwlock->try_read_lock = _try_read_lock;
+    rwlock->read_lock = _read_lock;
+    rwlock->try_write_lock = _try_write_lock;
+    rwlock->write_lock = _write_lock;
+    rwlock->unlock = _unlock;
+}
@@ -2,17 +2,58 @@
 // Copyright (c) 2018-2019 Mutant Industries ltd.
 #include <sync/semaphore.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <driver/interrupt.h>
 #include <process.h>
 
 
-static signal_t _try_acquire(Semaphore_t *_this) {
+// -------------------------------------------------------------------------------------
+
+static uint16_t _permits_requested(Action_t *action) {
+    // interrupts are disabled already
+
+    // blocked state signal of suspended process holds number of permits requested within acquire_n()
+    if (process_is_schedulable(action) && process_suspended(process(action))) {
+        return (uint16_t) (uintptr_t) process(action)->blocked_state_signal;
+    }
+
+    return 1;
+}
+
+static bool _head_satisfiable(Semaphore_t *_this) {
+    // interrupts are disabled already
+    Action_t *head = action_queue_head(&_this->_queue);
+
+    return head && semaphore_permits_cnt(_this) >= _permits_requested(head);
+}
+
+static void _dispatch(Semaphore_t *_this, signal_t signal) {
+    // interrupts are disabled already
+
+    // optimization - only trigger signal and context switch when it makes sense
+    if (_head_satisfiable(_this)) {
+        // the permits_count is going to be incremented within default trigger
+        semaphore_permits_cnt(_this)--;
+
+        signal_trigger(action_signal(_this), signal);
+    }
+}
+
+// -------------------------------------------------------------------------------------
+
+static signal_t _try_acquire_n(Semaphore_t *_this, uint16_t cnt) {
     signal_t result = SEMAPHORE_SUCCESS;
 
+    // sanity check
+    if ( ! cnt) {
+        return SEMAPHORE_INVALID_ARGUMENT;
+    }
+
     interrupt_suspend();
 
-    if (semaphore_permits_cnt(_this)) {
-        semaphore_permits_cnt(_this)--;
+    // permits released to waiting actions are not to be taken
+    if (action_queue_is_empty(&_this->_queue) && semaphore_permits_cnt(_this) >= cnt) {
+        semaphore_permits_cnt(_this) -= cnt;
     }
     else {
         result = SEMAPHORE_NO_PERMITS;
@@ -23,17 +64,41 @@ static signal_t _try_acquire(Semaphore_t *_this) {
     return result;
 }
 
-static signal_t _acquire(Semaphore_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config) {
+static signal_t _try_acquire(Semaphore_t *_this) {
+    return _try_acquire_n(_this, 1);
+}
+
+static signal_t _acquire_n(Semaphore_t *_this, uint16_t cnt, Time_unit_t *timeout, Schedule_config_t *with_config) {
+    signal_t result;
 
     interrupt_suspend();
-    // suspend running process if no permits are available, apply given config
-    suspend(_try_acquire(_this), &_this->_queue, timeout, with_config);
+
+    if ((result = _try_acquire_n(_this, cnt)) == SEMAPHORE_INVALID_ARGUMENT) {
+        interrupt_restore();
+
+        return result;
+    }
+
+    if (result == SEMAPHORE_NO_PERMITS) {
+        // requested permits count is kept in blocked state signal until process is woken up
+        result = signal((uintptr_t) cnt);
+    }
+
+    // suspend running process if not enough permits are available, apply given config
+    if (suspend(result, &_this->_queue, timeout, with_config) == signal((uintptr_t) cnt)) {
+        // running process might be placed in front of waiting action that can not be satisfied
+        _dispatch(_this, action_signal_input(_this));
+    }
 
     interrupt_restore();
 
     return running_process->blocked_state_signal;
 }
 
+static signal_t _acquire(Semaphore_t *_this, Time_unit_t *timeout, Schedule_config_t *with_config) {
+    return _acquire_n(_this, 1, timeout, with_config);
+}
+
 static signal_t _acquire_async(Semaphore_t *_this, Action_t *action) {
 
     // sanity check
@@ -44,62 +109,66 @@ static signal_t _acquire_async(Semaphore_t *_this, Action_t *action) {
     interrupt_suspend();
 
     action_queue_insert(&_this->_queue, action);
-
-    if (semaphore_permits_cnt(_this)) {
-        // if there are permits, trigger action execution outside current context
-        signal_trigger(action_signal(_this), action_signal_input(_this));
-        // permits_count was incremented within default trigger, which needs rollback
-        semaphore_permits_cnt(_this)--;
-    }
+    // if there are permits, trigger action execution outside current context
+    _dispatch(_this, action_signal_input(_this));
 
     interrupt_restore();
 
     return SEMAPHORE_SUCCESS;
 }
 
+static void _release_n(Semaphore_t *_this, uint16_t cnt, signal_t signal) {
+
+    interrupt_suspend();
+
+    semaphore_permits_cnt(_this) += cnt;
+    // whole batch is passed to waiting actions within single signal handler pass
+    _dispatch(_this, signal);
+
+    interrupt_restore();
+}
+
 static bool _signal(Semaphore_t *_this, signal_t signal) {
     Action_t *action_to_signal;
 
     interrupt_suspend();
 
-    // action queue might be empty already when signal handler reached
-    if ((action_to_signal = action_queue_head(&_this->_queue))) {
+    // action queue might be empty already when signal handler reached, trigger as many actions as permits allow
+    while (_head_satisfiable(_this)) {
+        action_to_signal = action_queue_head(&_this->_queue);
         // only decrement permits count if some action is actually going to be triggered
-        semaphore_permits_cnt(_this)--;
-    }
+        semaphore_permits_cnt(_this) -= _permits_requested(action_to_signal);
 
-    interrupt_restore();
+        interrupt_restore();
 
-    if (action_to_signal) {
         action_trigger(action_to_signal, signal);
+
+        interrupt_suspend();
     }
 
+    interrupt_restore();
+
     // stay in waiting loop
     return true;
 }
 
+static void _on_queue_released(Semaphore_t *_this, Action_t *action, Action_queue_t *origin) {
+    // interrupts are disabled already
+
+    // permits not taken by timed out, killed or disposed action might satisfy next waiting action
+    _dispatch(_this, action_signal_input(_this));
+}
+
 // -------------------------------------------------------------------------------------
 
 static bool _on_semaphore_handled(Semaphore_t *_this) {
     // interrupts are disabled already
 
-    return semaphore_permits_cnt(_this) != 0 && ! action_queue_is_empty(&_this->_queue);
+    return _head_satisfiable(_this);
 }
 
 static void _semaphore_trigger(Semaphore_t *_this, signal_t signal) {
-
-    interrupt_suspend();
-
-    if (action_queue_is_empty(&_this->_queue)) {
-        // optimization - only trigger signal and context switch when it makes sense
-        semaphore_permits_cnt(_this)++;
-    }
-    else {
-        // the permits_count is also going to be incremented within default trigger
-        signal_trigger(action_signal(_this), signal);
-    }
-
-    interrupt_restore();
+    _release_n(_this, 1, signal);
 }
 
 // Semaphore_t destructor
@@ -108,6 +177,12 @@ static dispose_function_t _semaphore_dispose(Semaphore_t *_this) {
     _this->acquire = (signal_t (*)(Semaphore_t *, Time_unit_t *, Schedule_config_t *)) unsupported_after_disposed;
     _this->try_acquire = (signal_t (*)(Semaphore_t *)) unsupported_after_disposed;
     _this->acquire_async = (signal_t (*)(Semaphore_t *, Action_t *)) unsupported_after_disposed;
+    _this->try_acquire_n = (signal_t (*)(Semaphore_t *, uint16_t)) unsupported_after_disposed;
+    _this->acquire_n = (signal_t (*)(Semaphore_t *, uint16_t, Time_unit_t *, Schedule_config_t *)) unsupported_after_disposed;
+    _this->release_n = (void (*)(Semaphore_t *, uint16_t, signal_t)) unsupported_after_disposed;
+
+    // no more dispatch to waiting actions
+    action_queue_on_released(&_this->_queue) = NULL;
 
     action_queue_close(&_this->_queue, SEMAPHORE_DISPOSED);
 
@@ -128,6 +203,8 @@ void semaphore_register(Semaphore_t *semaphore, uint16_t initial_permits_cnt, Pr
     action_on_released(semaphore) = NULL;
     // initialize semaphore queue
     action_queue_create(&semaphore->_queue, true, false, semaphore, action_default_set_priority);
+    // pass permits on whenever waiting action leaves the queue
+    action_queue_on_released(&semaphore->_queue) = (action_queue_released_hook_t) _on_queue_released;
 
     // state
     semaphore_permits_cnt(semaphore) = initial_permits_cnt;
@@ -136,4 +213,7 @@ void semaphore_register(Semaphore_t *semaphore, uint16_t initial_permits_cnt, Pr
     semaphore->try_acquire = _try_acquire;
     semaphore->acquire = _acquire;
     semaphore->acquire_async = _acquire_async;
+    semaphore->try_acquire_n = _try_acquire_n;
+    semaphore->acquire_n = _acquire_n;
+    semaphore->release_n = _release_n;
 }
@@ -14,33 +14,99 @@
 #define __TIMING_QUEUE_HANDLER_PRIORITY__           ((uint16_t) (0xFF00))
 #endif
 
+#ifndef __TIMING_WHEEL_SLOT_BITS__
+#define __TIMING_WHEEL_SLOT_BITS__                  3
+#endif
+
+#ifndef __TIMING_WHEEL_LEVELS__
+#define __TIMING_WHEEL_LEVELS__                     3
+#endif
+
+#define _WHEEL_SLOTS                                (1 << __TIMING_WHEEL_SLOT_BITS__)
+#define _WHEEL_SLOT_MASK                            ((uint32_t) (_WHEEL_SLOTS - 1))
+// number of first level slots covered by whole wheel
+#define _WHEEL_SPAN                                 ((uint32_t) 1 << (__TIMING_WHEEL_SLOT_BITS__ * __TIMING_WHEEL_LEVELS__))
+
 // -------------------------------------------------------------------------------------
 
-// timer driver handle
-static Timing_handle_t *_timing_handle;
+#ifndef __TIMING_CHANNEL_CNT__
+#define __TIMING_CHANNEL_CNT__                      1
+#endif
 
-// timed signal queue, sorted by priority desc, _unsorted_queue_handler inherits it's priority
-__persistent static Action_queue_t _unsorted_signal_queue = {0};
-// timed signal, sorted by _trigger_time in ascending order
-__persistent static Action_queue_t _upcoming_signal_queue = {0};
+#define _default_channel                            (&_timing_channels[0])
 
+// -------------------------------------------------------------------------------------
+
+#ifndef __TIMING_BUSY_WAIT_THRESHOLD__
+#define __TIMING_BUSY_WAIT_THRESHOLD__              ((uint32_t) 50)
+#endif
+
+// -------------------------------------------------------------------------------------
+
+/**
+ * Timer channel with timed signals of it's own, programs it's own timer compare register
+ */
+struct Timing_channel {
+    // timer driver handle, NULL if channel is not registered
+    Timing_handle_t *_handle;
+
+    // timed signal, sorted by _trigger_time in ascending order, contains all signals up to _timing_wheel_time
+    Action_queue_t _upcoming_signal_queue;
+    // timed signals scheduled beyond _timing_wheel_time, slots are not sorted
+    Action_queue_t _timing_wheel[__TIMING_WHEEL_LEVELS__][_WHEEL_SLOTS];
+    // number of timed signals in timing wheel
+    uint16_t _timing_wheel_signal_cnt;
+    // timed signals handled directly within timer interrupt service, sorted by _trigger_time in ascending order
+    Action_queue_t _interrupt_signal_queue;
+    // signal triggered when (one or more) upcoming signal(s) should be triggered, owner is the channel
+    Action_signal_t _upcoming_queue_handler;
+
+    // -------- state --------
+    // absolute time that corresponds to _handle->_timer_counter_last_stable
+    uint64_t _current_time_last_stable;
+    // time tracking request count (user requests + unhandled periodic signals count)
+    uint16_t _track_time_request_cnt;
+    // absolute time of start of first level slot, that has not been moved to upcoming signal queue yet
+    uint64_t _timing_wheel_time;
+    // first level index of that slot, wheel position on higher levels is derived from it
+    uint32_t _timing_wheel_cursor;
+    // first level slot width - largest power of 2 usecs not exceeding timer overflow increment
+    uint8_t _timing_wheel_slot_shift;
+    // duration of single timer tick in usecs (at least 1), signals are routed to channels by it
+    uint32_t _resolution;
+
+};
+
+// timer channels, the first one is default - time base of absolute time, time tracking and statistics
+__persistent static Timing_channel_t _timing_channels[__TIMING_CHANNEL_CNT__] = {{0}};
+
+// timed signal queue shared by all channels, sorted by priority desc, _unsorted_queue_handler inherits it's priority
+__persistent static Action_queue_t _unsorted_signal_queue = {0};
 // signal triggered when new timed signal schedule request is created
 __persistent static Action_signal_t _unsorted_queue_handler = {0};
-// signal triggered when (one or more) upcoming signal(s) should be triggered
-__persistent static Action_signal_t _upcoming_queue_handler = {0};
 
-// absolute time that corresponds to _timing_handle->_timer_counter_last_stable
-static Time_unit_t _current_time_last_stable;
+// number of timer compare interrupts saved by firing signals with overlapping slack windows at once
+static uint32_t _coalesced_interrupt_cnt;
+// number of timed signals placed to their channel right away, without _unsorted_queue_handler round trip
+static uint32_t _avoided_switch_cnt;
 
-// time tracking request count (user requests + unhandled periodic signals count)
-static uint16_t _track_time_request_cnt;
+#ifdef __TIMING_STATISTICS_ENABLE__
+// lateness statistics of all timed signals
+static Timing_statistics_t _timing_statistics;
+// reset value
+static const Timing_statistics_t _timing_statistics_empty = {{0}};
+#endif
 
 
 // -------------------------------------------------------------------------------------
 // time conversion, time unit manipulation
 
-#define HOUR_SECONDS        ((uint32_t) (3600))
-#define HOUR_MICROSECONDS   ((uint32_t) (HOUR_SECONDS * 1000 * 1000))
+// conversion of timer ticks, reciprocal multiplication unless conversion functions set
+#define _ticks_to_usecs(_handle, _ticks) ((_handle)->ticks_to_usecs ? (_handle)->ticks_to_usecs(_ticks) \
+        : (uint32_t) ((((uint64_t) (_ticks)) * (_handle)->_ticks_to_usecs_multiplier) >> (_handle)->_ticks_to_usecs_shift))
+#define _usecs_to_ticks(_handle, _usecs) ((_handle)->usecs_to_ticks ? (_handle)->usecs_to_ticks(_usecs) \
+        : (uint32_t) ((((uint64_t) (_usecs)) * (_handle)->_usecs_to_ticks_multiplier \
+                + (((uint64_t) 1 << (_handle)->_usecs_to_ticks_shift) - 1)) >> (_handle)->_usecs_to_ticks_shift))
 
 #ifdef __TIMING_CONVERSION_AVOID_HW_MULTIPLICATION__
 
@@ -79,28 +145,35 @@ static uint32_t _mul_1000(uint32_t value) {
 
 #endif
 
-static void _time_unit_add_usecs(Time_unit_t *target, uint32_t usecs) {
+// conversion to monotonic time in usecs since timing start, which is used internally - wrap-free for ~ 500_000 years
+#define _time_unit_to_usecs(_time_unit) (((uint64_t) (_time_unit)->hrs) * HOUR_MICROSECONDS + (_time_unit)->usecs)
+#define _time_unit_is_zero(_time_unit) ( ! (_time_unit)->hrs && ! (_time_unit)->usecs)
 
-    // check whether 32-bit usecs going to overflow
-    if (target->usecs > UINT32_MAX - usecs) {
-        target->hrs++;
-    }
+// floor(2^52 / HOUR_MICROSECONDS) - hours of usecs by multiplication, (usecs >> 20) * reciprocal >> 32
+#define _HOUR_MICROSECONDS_RECIPROCAL               ((uint32_t) 1250999)
 
-    target->usecs += usecs;
+Time_unit_t *time_unit_from_usecs(Time_unit_t *target, uint64_t usecs) {
+    // never above exact number of hours and at most 2 below, no 64-bit division
+    uint32_t hrs = (uint32_t) ((((uint64_t) (uint32_t) (usecs >> 20)) * _HOUR_MICROSECONDS_RECIPROCAL) >> 32);
 
-    // usecs never exceeds HOUR_MICROSECONDS
-    if (target->usecs >= HOUR_MICROSECONDS) {
-        target->hrs++;
-        // max once
-        target->usecs -= HOUR_MICROSECONDS;
+    usecs -= ((uint64_t) hrs) * HOUR_MICROSECONDS;
+
+    while (usecs >= HOUR_MICROSECONDS) {
+        hrs++;
+        usecs -= HOUR_MICROSECONDS;
     }
+
+    target->hrs = (uint16_t) hrs;
+    target->usecs = (uint32_t) usecs;
+
+    return target;
 }
 
 static uint32_t _no_conversion(uint32_t value) {
     return value;
 }
 
-Time_unit_t * time_unit_from(Time_unit_t *time_unit, uint16_t hrs, uint16_t secs, uint16_t millisecs, uint32_t usecs) {
+Time_unit_t * (time_unit_from)(Time_unit_t *time_unit, uint16_t hrs, uint16_t secs, uint16_t millisecs, uint32_t usecs) {
     time_unit->hrs = hrs;
 
 #ifdef __TIMING_CONVERSION_AVOID_HW_MULTIPLICATION__
@@ -118,60 +191,244 @@ Time_unit_t * time_unit_from(Time_unit_t *time_unit, uint16_t hrs, uint16_t secs
     return time_unit;
 }
 
+Time_unit_t *time_unit_add(Time_unit_t *target, Time_unit_t *delta) {
+    target->hrs += delta->hrs;
+
+    // no 32-bit usecs overflow, both operands do not exceed HOUR_MICROSECONDS
+    if (target->usecs >= HOUR_MICROSECONDS - delta->usecs) {
+        target->hrs++;
+        target->usecs -= HOUR_MICROSECONDS - delta->usecs;
+    }
+    else {
+        target->usecs += delta->usecs;
+    }
+
+    return target;
+}
+
 // -------------------------------------------------------------------------------------
+// timing wheel, assume interrupts are disabled already
+
+#define _timing_wheel_slot(_channel, _level, _index) (&(_channel)->_timing_wheel[_level][(_index) & _WHEEL_SLOT_MASK])
+#define _is_timing_wheel_slot(_channel, _queue) ((_queue) >= &(_channel)->_timing_wheel[0][0] \
+        && (_queue) <= &(_channel)->_timing_wheel[__TIMING_WHEEL_LEVELS__ - 1][_WHEEL_SLOTS - 1])
+
+/**
+ * Sorted insert to given queue, searched from the farthermost signal, return true if signal becomes head
+ */
+static bool _timed_signal_queue_insert(Action_queue_t *queue, Timed_signal_t *signal) {
+    Timed_signal_t *head = timed_signal(action_queue_head(queue)), *current;
+
+    if ( ! head || timed_signal_trigger_usecs(signal) < timed_signal_trigger_usecs(head)) {
+        // queue empty or closest upcoming signal
+        deque_insert_first(deque(queue), deque_item(signal));
+
+        return true;
+    }
+
+    current = timed_signal(deque_item_prev(head));
+
+    // place behind last signal that is not going to be triggered later, head is the last one to be checked
+    while (timed_signal_trigger_usecs(signal) < timed_signal_trigger_usecs(current)) {
+        current = timed_signal(deque_item_prev(current));
+    }
 
-static void _timing_restart() {
+    deque_insert_after(deque_item(signal), deque_item(current));
+
+    return false;
+}
+
+/**
+ * Number of first level slots between _timing_wheel_time and given time (not before _timing_wheel_time),
+ * saturated to the wheel span
+ */
+static uint32_t _timing_wheel_distance(Timing_channel_t *channel, uint64_t time) {
+    uint64_t distance = (time - channel->_timing_wheel_time) >> channel->_timing_wheel_slot_shift;
+
+    // signals out of range are going to be cascaded again when the wheel gets closer
+    return distance < _WHEEL_SPAN ? (uint32_t) distance : _WHEEL_SPAN - 1;
+}
+
+/**
+ * Place unlinked signal to timing wheel in O(1) or to upcoming signal queue if it's slot was reached already,
+ * return true if signal becomes head of upcoming signal queue
+ */
+static bool _timing_wheel_insert(Timing_channel_t *channel, Timed_signal_t *signal) {
+    uint32_t distance;
+    uint8_t level = 0;
+
+    if (timed_signal_trigger_usecs(signal) < channel->_timing_wheel_time) {
+        return _timed_signal_queue_insert(&channel->_upcoming_signal_queue, signal);
+    }
+
+    distance = _timing_wheel_distance(channel, timed_signal_trigger_usecs(signal));
+
+    // the lowest level able to cover given distance
+    while (level < __TIMING_WHEEL_LEVELS__ - 1 && distance >> (__TIMING_WHEEL_SLOT_BITS__ * (level + 1))) {
+        level++;
+    }
+
+    deque_insert_last(deque(_timing_wheel_slot(channel, level, (channel->_timing_wheel_cursor + distance)
+            >> (__TIMING_WHEEL_SLOT_BITS__ * level))), deque_item(signal));
+
+    channel->_timing_wheel_signal_cnt++;
+
+    return false;
+}
+
+/**
+ * Place all signals from given slot according to current wheel position
+ */
+static void _timing_wheel_slot_cascade(Timing_channel_t *channel, Action_queue_t *slot) {
+    Deque_item_t *chain = NULL, *item;
+
+    // detach whole slot first - signals out of wheel range are placed to the same slot again
+    while ((item = deque_item(action_queue_head(slot)))) {
+        deque_insert_last(&chain, item);
+
+        channel->_timing_wheel_signal_cnt--;
+    }
+
+    while ((item = chain)) {
+        deque_item_remove(item);
+
+        _timing_wheel_insert(channel, timed_signal(item));
+    }
+}
+
+/**
+ * Move all signals that might be triggered before next stable increment to upcoming signal queue
+ */
+static void _timing_wheel_advance(Timing_channel_t *channel) {
+    uint64_t horizon = channel->_current_time_last_stable + channel->_handle->_timer_overflow_us_increment;
+    Action_queue_t *slot;
+    uint8_t level;
+
+    while (channel->_timing_wheel_time <= horizon) {
+        slot = _timing_wheel_slot(channel, 0, channel->_timing_wheel_cursor);
+
+        channel->_timing_wheel_cursor++;
+        channel->_timing_wheel_time += (uint32_t) 1 << channel->_timing_wheel_slot_shift;
+
+        // all signals from reached slot precede _timing_wheel_time now
+        _timing_wheel_slot_cascade(channel, slot);
+
+        // slot boundary on higher level reached when all lower level indexes wrap
+        for (level = 1; level < __TIMING_WHEEL_LEVELS__
+                && ! (channel->_timing_wheel_cursor & (((uint32_t) 1 << (__TIMING_WHEEL_SLOT_BITS__ * level)) - 1)); level++) {
+
+            _timing_wheel_slot_cascade(channel, _timing_wheel_slot(channel, level, channel->_timing_wheel_cursor >> (__TIMING_WHEEL_SLOT_BITS__ * level)));
+        }
+    }
+}
+
+/**
+ * Place all signals according to current wheel geometry (after slot width changed)
+ */
+static void _timing_wheel_rebuild(Timing_channel_t *channel) {
+    uint8_t level;
+    uint16_t index;
+
+    for (level = 0; level < __TIMING_WHEEL_LEVELS__; level++) {
+        for (index = 0; index < _WHEEL_SLOTS; index++) {
+            _timing_wheel_slot_cascade(channel, _timing_wheel_slot(channel, level, index));
+        }
+    }
+
+    _timing_wheel_advance(channel);
+}
+
+/**
+ * Signal with the lowest trigger time in timing wheel, each level is searched for it's first non-empty slot,
+ * O(levels * slots + signals within those slots)
+ */
+static Timed_signal_t *_timing_wheel_upcoming(Timing_channel_t *channel) {
+    Timed_signal_t *result = NULL, *head, *current;
+    uint8_t level;
+    uint16_t offset;
+
+    for (level = 0; level < __TIMING_WHEEL_LEVELS__; level++) {
+        // first level starts at cursor, slot at cursor position on higher levels was cascaded already
+        for (offset = level ? 1 : 0; offset < _WHEEL_SLOTS + (level ? 1 : 0); offset++) {
+
+            if ((current = head = timed_signal(action_queue_head(_timing_wheel_slot(channel, level,
+                    (channel->_timing_wheel_cursor >> (__TIMING_WHEEL_SLOT_BITS__ * level)) + offset))))) {
+
+                do {
+                    if ( ! result || timed_signal_trigger_usecs(current) < timed_signal_trigger_usecs(result)) {
+                        result = current;
+                    }
+                }
+                while ((current = timed_signal(deque_item_next(current))) != head);
+
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+// -------------------------------------------------------------------------------------
+
+static void _timing_restart(Timing_channel_t *channel) {
 
     interrupt_suspend();
 
-    timer_channel_start(_timing_handle);
+    timer_channel_start(channel->_handle);
     // expect that timer counter can contain any random value now
-    timer_channel_get_counter(_timing_handle, &_timing_handle->_timer_counter_last_stable);
+    timer_channel_get_counter(channel->_handle, &channel->_handle->_timer_counter_last_stable);
     // set next interrupt in next static increment
-    timer_channel_set_compare_value(_timing_handle, (_timing_handle->_timer_counter_last_stable
-                    + _timing_handle->_timer_overflow_ticks_increment) & _timing_handle->_timer_counter_mask);
+    timer_channel_set_compare_value(channel->_handle, (channel->_handle->_timer_counter_last_stable
+                    + channel->_handle->_timer_overflow_ticks_increment) & channel->_handle->_timer_counter_mask);
     // clear interrupt in case triggered within this function
-    vector_clear_interrupt_flag(_timing_handle);
+    vector_clear_interrupt_flag(channel->_handle);
 
     // current time reset
-    time_unit_reset(&_current_time_last_stable);
+    channel->_current_time_last_stable = 0;
+
+    // timing wheel starts with current time
+    channel->_timing_wheel_time = 0;
+    channel->_timing_wheel_cursor = 0;
+    _timing_wheel_advance(channel);
 
     interrupt_restore();
 }
 
-bool get_current_time(Time_unit_t *target) {
+static bool _get_current_time(Timing_channel_t *channel, uint64_t *target) {
     // increment since last stable value
     uint32_t timer_counter_increment;
     // must be set to zero since timer handle might only set lower 16 bits
     uint32_t current_timer_counter_read = 0;
 
-    if ( ! timer_channel_is_active(_timing_handle)) {
+    if ( ! channel->_handle || ! timer_channel_is_active(channel->_handle)) {
         return false;
     }
 
     interrupt_suspend();
 
-    timer_channel_get_counter(_timing_handle, &current_timer_counter_read);
+    timer_channel_get_counter(channel->_handle, &current_timer_counter_read);
 
-    timer_counter_increment = (current_timer_counter_read - _timing_handle->_timer_counter_last_stable) & _timing_handle->_timer_counter_mask;
+    timer_counter_increment = (current_timer_counter_read - channel->_handle->_timer_counter_last_stable) & channel->_handle->_timer_counter_mask;
 
     // see if _current_time_last_stable has to get static increment
-    if (timer_counter_increment >= _timing_handle->_timer_overflow_ticks_increment) {
+    if (timer_counter_increment >= channel->_handle->_timer_overflow_ticks_increment) {
         // add static increment to current time
-        _time_unit_add_usecs(&_current_time_last_stable, _timing_handle->_timer_overflow_us_increment);
+        channel->_current_time_last_stable += channel->_handle->_timer_overflow_us_increment;
         // store last (stable) read value
-        _timing_handle->_timer_counter_last_stable = (_timing_handle->_timer_counter_last_stable + _timing_handle->_timer_overflow_ticks_increment) & _timing_handle->_timer_counter_mask;
+        channel->_handle->_timer_counter_last_stable = (channel->_handle->_timer_counter_last_stable + channel->_handle->_timer_overflow_ticks_increment) & channel->_handle->_timer_counter_mask;
         // set timer to next increment
-        timer_channel_set_compare_value(_timing_handle, (_timing_handle->_timer_counter_last_stable + _timing_handle->_timer_overflow_ticks_increment) & _timing_handle->_timer_counter_mask);
+        timer_channel_set_compare_value(channel->_handle, (channel->_handle->_timer_counter_last_stable + channel->_handle->_timer_overflow_ticks_increment) & channel->_handle->_timer_counter_mask);
+
+        timer_counter_increment -= channel->_handle->_timer_overflow_ticks_increment;
 
-        timer_counter_increment -= _timing_handle->_timer_overflow_ticks_increment;
+        // move signals that might be triggered before next stable increment to upcoming signal queue
+        _timing_wheel_advance(channel);
     }
 
     if (target) {
-        // copy stable value to target...
-        time_unit_copy(&_current_time_last_stable, target);
-        // ...and add actual difference
-        _time_unit_add_usecs(target, _timing_handle->ticks_to_usecs(timer_counter_increment));
+        // stable value plus actual difference
+        *target = channel->_current_time_last_stable + _ticks_to_usecs(channel->_handle, timer_counter_increment);
     }
 
     interrupt_restore();
@@ -179,41 +436,271 @@ bool get_current_time(Time_unit_t *target) {
     return true;
 }
 
-void set_track_current_time(bool track) {
+bool get_current_time(Time_unit_t *target) {
+    uint64_t current_time;
+
+    if ( ! _get_current_time(_default_channel, target ? &current_time : NULL)) {
+        return false;
+    }
+
+    if (target) {
+        time_unit_from_usecs(target, current_time);
+    }
+
+    return true;
+}
+
+bool get_current_usecs(uint64_t *target) {
+    return _get_current_time(_default_channel, target);
+}
+
+static void _set_track_time(Timing_channel_t *channel, bool track) {
 
     interrupt_suspend();
 
     if (track) {
-        if ( ! timer_channel_is_active(_timing_handle)) {
-            _timing_restart();
+        if ( ! timer_channel_is_active(channel->_handle)) {
+            _timing_restart(channel);
         }
 
-        _track_time_request_cnt++;
+        channel->_track_time_request_cnt++;
     }
     else {
-        _track_time_request_cnt--;
+        channel->_track_time_request_cnt--;
     }
 
     interrupt_restore();
 }
 
+void set_track_current_time(bool track) {
+    _set_track_time(_default_channel, track);
+}
+
+/**
+ * Signal of given channel with the lowest trigger time, interrupts are disabled already
+ */
+static Timed_signal_t *_channel_upcoming(Timing_channel_t *channel) {
+    Timed_signal_t *upcoming = NULL;
+
+    if ( ! action_queue_is_empty(&channel->_upcoming_signal_queue)) {
+        upcoming = timed_signal(action_queue_head(&channel->_upcoming_signal_queue));
+    }
+    else if (channel->_timing_wheel_signal_cnt) {
+        upcoming = _timing_wheel_upcoming(channel);
+    }
+
+    if ( ! action_queue_is_empty(&channel->_interrupt_signal_queue) && ( ! upcoming || timed_signal_trigger_usecs(
+            action_queue_head(&channel->_interrupt_signal_queue)) < timed_signal_trigger_usecs(upcoming))) {
+
+        upcoming = timed_signal(action_queue_head(&channel->_interrupt_signal_queue));
+    }
+
+    return upcoming;
+}
+
 bool get_upcoming_event_time(Time_unit_t *target) {
-    bool result;
+    Timing_channel_t *channel;
+    Timed_signal_t *upcoming;
+    uint64_t event_time, current_time, default_time = 0, result = UINT64_MAX;
 
     interrupt_suspend();
 
-    if ((result = ! action_queue_is_empty(&_upcoming_signal_queue))) {
+    // time of other channels is expressed in time of default channel
+    _get_current_time(_default_channel, &default_time);
+
+    for (channel = _timing_channels; channel < _timing_channels + __TIMING_CHANNEL_CNT__; channel++) {
+        if ( ! channel->_handle || ! (upcoming = _channel_upcoming(channel))) {
+            continue;
+        }
+
+        event_time = timed_signal_trigger_usecs(upcoming);
+
+        if (channel != _default_channel && _get_current_time(channel, &current_time)) {
+            // remaining time on given channel
+            event_time = default_time + (event_time > current_time ? event_time - current_time : 0);
+        }
+
+        if (event_time < result) {
+            result = event_time;
+        }
+    }
+
+    if (result != UINT64_MAX) {
         // copy time of next upcoming signal to target
-        time_unit_copy(timed_signal_trigger_time(action_queue_head(&_upcoming_signal_queue)), target);
+        time_unit_from_usecs(target, result);
     }
 
     interrupt_restore();
 
+    return result != UINT64_MAX;
+}
+
+uint32_t get_coalesced_interrupt_count() {
+    uint32_t result;
+
+    // no torn read of 32-bit counter updated from interrupt service
+    interrupt_suspend();
+
+    result = _coalesced_interrupt_cnt;
+
+    interrupt_restore();
+
+    return result;
+}
+
+uint32_t get_avoided_switch_count() {
+    uint32_t result;
+
+    // no torn read of 32-bit counter updated from interrupt service
+    interrupt_suspend();
+
+    result = _avoided_switch_cnt;
+
+    interrupt_restore();
+
     return result;
 }
 
+#ifndef __TIMING_BUSY_WAIT_DISABLE__
+
+bool timing_busy_wait(Time_unit_t *delay) {
+    uint64_t start, current_time;
+    bool result;
+
+    if (delay->hrs || ! _default_channel->_handle || delay->usecs >= _default_channel->_handle->_busy_wait_threshold) {
+        return false;
+    }
+
+    // interrupts stay enabled, keep timer running so that it is not stopped by timing handle service while spinning
+    _set_track_time(_default_channel, true);
+
+    if ((result = _get_current_time(_default_channel, &start))) {
+        do {
+            if ( ! (result = _get_current_time(_default_channel, &current_time))) {
+                break;
+            }
+        }
+        while (current_time - start < delay->usecs);
+    }
+
+    _set_track_time(_default_channel, false);
+
+    return result;
+}
+
+#endif
+
 // -------------------------------------------------------------------------------------
 
+#ifdef __TIMING_STATISTICS_ENABLE__
+
+static bool _on_timed_signal_handled(Timed_signal_t *_this);
+
+static void _timing_lateness_record(Timing_lateness_t *lateness, uint32_t usecs) {
+
+    if ( ! lateness->cnt || usecs < lateness->min) {
+        lateness->min = usecs;
+    }
+
+    if (usecs > lateness->max) {
+        lateness->max = usecs;
+    }
+
+    lateness->sum += usecs;
+    lateness->cnt++;
+}
+
+/**
+ * Record lateness of given signal at given time, interrupts are disabled already
+ */
+static void _timed_signal_lateness_record(Timed_signal_t *signal, uint64_t current_time, bool handler_start) {
+    uint64_t lateness = current_time > timed_signal_trigger_usecs(signal) ? current_time - timed_signal_trigger_usecs(signal) : 0;
+    uint64_t period;
+
+    if (lateness > UINT32_MAX) {
+        lateness = UINT32_MAX;
+    }
+
+    if (handler_start) {
+        _timing_lateness_record(&timed_signal_statistics(signal)->handler, (uint32_t) lateness);
+        _timing_lateness_record(&_timing_statistics.handler, (uint32_t) lateness);
+
+        return;
+    }
+
+    _timing_lateness_record(&timed_signal_statistics(signal)->trigger, (uint32_t) lateness);
+    _timing_lateness_record(&_timing_statistics.trigger, (uint32_t) lateness);
+
+    // division only if at least one period missed
+    if (signal->_periodic && lateness >= (period = _time_unit_to_usecs(timed_signal_delay(signal))) && period) {
+        timed_signal_statistics(signal)->missed_period_cnt += (uint32_t) (lateness / period);
+        _timing_statistics.missed_period_cnt += (uint32_t) (lateness / period);
+    }
+}
+
+void get_timing_statistics(Timing_statistics_t *target) {
+
+    interrupt_suspend();
+
+    *target = _timing_statistics;
+
+    interrupt_restore();
+}
+
+void timing_statistics_reset(Timing_statistics_t *statistics) {
+
+    interrupt_suspend();
+
+    *(statistics ? statistics : &_timing_statistics) = _timing_statistics_empty;
+
+    interrupt_restore();
+}
+
+void timing_signal_handler_start(Action_signal_t *signal) {
+    uint64_t current_time;
+
+    // timed signal triggered by timing (not by another source)
+    if (action_signal_input(signal) != TIMING_SIGNAL_TIMEOUT
+            || action_signal_on_handled(signal) != (bool (*)(Action_signal_t *)) _on_timed_signal_handled) {
+        return;
+    }
+
+    interrupt_suspend();
+
+    if (_get_current_time(timed_signal(signal)->_channel, &current_time)) {
+        _timed_signal_lateness_record(timed_signal(signal), current_time, true);
+    }
+
+    interrupt_restore();
+}
+
+#endif
+
+// -------------------------------------------------------------------------------------
+
+/**
+ * Time when upcoming signal queue head shall be triggered - the latest trigger time of group of signals
+ * starting with head whose [trigger_time, trigger_time + slack] windows overlap, O(group size)
+ */
+static uint64_t _upcoming_signal_queue_fire_time(Timing_channel_t *channel) {
+    // interrupts are disabled already
+
+    Timed_signal_t *head = timed_signal(action_queue_head(&channel->_upcoming_signal_queue)), *current = head;
+    uint64_t fire_time = timed_signal_trigger_usecs(head);
+    uint64_t deadline = fire_time + head->slack;
+
+    while ((current = timed_signal(deque_item_next(current))) != head && timed_signal_trigger_usecs(current) <= deadline) {
+        fire_time = timed_signal_trigger_usecs(current);
+
+        // group window is the intersection of all windows within group
+        if (fire_time + current->slack < deadline) {
+            deadline = fire_time + current->slack;
+        }
+    }
+
+    return fire_time;
+}
+
 static bool _timer_increment_compare_value(Timing_handle_t *handle, uint32_t increment) {
     // interrupts are disabled already
 
@@ -249,94 +736,192 @@ static bool _timer_increment_compare_value(Timing_handle_t *handle, uint32_t inc
     return result;
 }
 
-static bool _check_upcoming_signal_queue(bool trigger_upcoming_queue_handler) {
+/**
+ * Move trigger time of periodic signal to next period according to it's overrun policy
+ */
+static void _periodic_trigger_time_update(Timed_signal_t *signal) {
+    // interrupts are disabled already
+
+    uint64_t period = _time_unit_to_usecs(timed_signal_delay(signal));
+    uint64_t current_time;
+    uint32_t missed_cnt;
+    // interrupt context signal never catches up - missed periods would be handled back-to-back within interrupt service
+    uint8_t overrun_policy = signal->_interrupt_context ? TIMED_SIGNAL_OVERRUN_SKIP : signal->overrun_policy;
+
+    timed_signal_trigger_usecs(signal) += period;
+    signal->_missed_cnt = 0;
+
+    // no timer read unless overrun matters, zero period (standard signal only) is always due
+    if ((overrun_policy == TIMED_SIGNAL_OVERRUN_CATCH_UP && ! signal->on_overrun) || ! period
+            || ! _get_current_time(signal->_channel, &current_time) || timed_signal_trigger_usecs(signal) > current_time) {
+        return;
+    }
+
+    // number of period boundaries that passed already, division on overrun only
+    missed_cnt = (uint32_t) ((current_time - timed_signal_trigger_usecs(signal)) / period) + 1;
+
+    if (overrun_policy == TIMED_SIGNAL_OVERRUN_SKIP) {
+        // next period in future
+        timed_signal_trigger_usecs(signal) += missed_cnt * period;
+        signal->_missed_cnt = missed_cnt;
+    }
+    else if (overrun_policy == TIMED_SIGNAL_OVERRUN_COALESCE) {
+        // last period that passed, triggered right away
+        timed_signal_trigger_usecs(signal) += (missed_cnt - 1) * period;
+        signal->_missed_cnt = missed_cnt - 1;
+    }
+
+    if (signal->on_overrun) {
+        signal->on_overrun(signal, missed_cnt);
+    }
+}
+
+/**
+ * Execute handlers of all due interrupt context signals, wait for those that are too close to be set as timer compare value
+ *  - each signal is handled at most once per call, periodic signals are placed back to queue for next timer compare
+ * once all due signals are handled
+ */
+static void _interrupt_signal_queue_handle(Timing_channel_t *channel) {
     // interrupts are disabled already
 
     // static - stack usage optimization
-    static Time_unit_t current_time;
+    static uint64_t current_time;
+    // handled periodic signals on their way back to queue, signals released from handler meanwhile are just skipped
+    Action_queue_t rescheduled;
+    Timed_signal_t *signal;
 
-    // assert upcoming signal queue is not empty
-    Time_unit_t *head_trigger_time = timed_signal_trigger_time(action_queue_head(&_upcoming_signal_queue));
+    action_queue_create(&rescheduled, false);
 
-    // assert timing is active when this point reached (upcoming signal queue is not empty)
-    get_current_time(&current_time);
+    while ((signal = timed_signal(action_queue_head(&channel->_interrupt_signal_queue)))) {
 
-    if (head_trigger_time->hrs < current_time.hrs
-            || head_trigger_time->hrs <= current_time.hrs && head_trigger_time->usecs <= current_time.usecs) {
+        // assert timing is active when this point reached (interrupt signal queue is not empty)
+        _get_current_time(channel, &current_time);
 
-        if (trigger_upcoming_queue_handler) {
-            // just keep time tracking running...
-            _timer_increment_compare_value(_timing_handle, _timing_handle->_timer_overflow_ticks_increment);
-            // ...and trigger upcoming queue handler signal
-            action_trigger(&_upcoming_queue_handler, NULL);
+        if (timed_signal_trigger_usecs(signal) > current_time) {
+            // done unless the signal is due sooner than timer compare value can be set
+            if (timed_signal_trigger_usecs(signal) - current_time > channel->_handle->_timer_overflow_us_increment
+                    || _usecs_to_ticks(channel->_handle, (uint32_t) (timed_signal_trigger_usecs(signal) - current_time))
+                            > channel->_handle->_timer_compare_value_set_threshold) {
+                break;
+            }
+
+            continue;
         }
-        else {
-            // signal that has trigger_time <= current_time
-            Timed_signal_t *signal = timed_signal(action_queue_head(&_upcoming_signal_queue));
 
-            // create time tracking request if signal is periodic
-            if (signal->_periodic) {
-                // create time tracking request
-                _track_time_request_cnt++;
-            }
+        action_queue_pop(&channel->_interrupt_signal_queue);
 
-            // just trigger signal, timer compare value shall be changed within next call (if required)
-            action_trigger(signal, TIMING_SIGNAL_TIMEOUT);
+#ifdef __TIMING_STATISTICS_ENABLE__
+        _timed_signal_lateness_record(signal, current_time, false);
+        _timed_signal_lateness_record(signal, current_time, true);
+#endif
+
+        // zero period (delay changed while scheduled) would never leave the queue, handled as one-shot then
+        if (signal->_periodic && ! _time_unit_is_zero(timed_signal_delay(signal))) {
+            _periodic_trigger_time_update(signal);
+
+            // no release hook, nothing to be done on leaving interrupt signal queue
+            deque_insert_last(deque(&rescheduled), deque_item(signal));
         }
 
-        return true;    // upcoming event queue might contain more signals that should be triggered
+        // handler executed with interrupts disabled, return value ignored
+        action_handler(signal)(action_owner(signal), TIMING_SIGNAL_TIMEOUT);
+    }
+
+    // O(n) with respect to interrupt context signals per handled periodic signal
+    while ((signal = timed_signal(action_queue_head(&rescheduled)))) {
+        _timed_signal_queue_insert(&channel->_interrupt_signal_queue, signal);
+    }
+}
+
+/**
+ * Set timer compare value to the closest event or trigger upcoming queue handler if upcoming signals are due
+ *  - interrupt context signals are only executed within timer interrupt service, if one is due sooner than timer
+ * compare value can be set otherwise, timer interrupt is requested right away
+ */
+static void _check_upcoming_signal_queue(Timing_channel_t *channel, bool interrupt_service) {
+    // interrupts are disabled already
+
+    // static - stack usage optimization
+    static uint64_t current_time, fire_time;
+    bool interrupt_signal_first = false;
+
+    // interrupt context signals always first
+    if (interrupt_service) {
+        _interrupt_signal_queue_handle(channel);
     }
-    else if (head_trigger_time->hrs == current_time.hrs
-             || head_trigger_time->hrs == current_time.hrs + 1 && head_trigger_time->usecs < current_time.usecs) {
 
-        // in how many usecs is next upcoming signal going to be triggered
-        uint32_t upcoming_signal_in_usecs = head_trigger_time->usecs - _current_time_last_stable.usecs;
+    // assert timing is active when this point reached (upcoming / interrupt signal queue is not empty)
+    _get_current_time(channel, &current_time);
 
-        // overflow usecs - when head_trigger_time->hrs == current_time.hrs + 1 && head_trigger_time->usecs < current_time.usecs
-        if (head_trigger_time->usecs < _current_time_last_stable.usecs) {
-            upcoming_signal_in_usecs += HOUR_MICROSECONDS;
+    fire_time = action_queue_is_empty(&channel->_upcoming_signal_queue) ? UINT64_MAX : _upcoming_signal_queue_fire_time(channel);
+
+    if (fire_time <= current_time) {
+        // trigger upcoming queue handler signal, that shall trigger all due signals at once...
+        action_trigger(&channel->_upcoming_queue_handler, NULL);
+        // ...timer compare value is only set for interrupt context signals or time tracking then
+        fire_time = UINT64_MAX;
+    }
+
+    // timer compare value is shared with interrupt context signals
+    if ( ! action_queue_is_empty(&channel->_interrupt_signal_queue)
+            && timed_signal_trigger_usecs(action_queue_head(&channel->_interrupt_signal_queue)) < fire_time) {
+
+        fire_time = timed_signal_trigger_usecs(action_queue_head(&channel->_interrupt_signal_queue));
+        interrupt_signal_first = true;
+
+        // interrupt context signal might be due already, next timer compare as soon as possible
+        if (fire_time < current_time) {
+            fire_time = current_time;
         }
+    }
 
-        // see if upcoming signal fits to next CCR increment - if so try to set timer compare value
-        if (upcoming_signal_in_usecs <= _timing_handle->_timer_overflow_us_increment) {
-            // if upcoming event too close
-            if (_timer_increment_compare_value(_timing_handle, _timing_handle->usecs_to_ticks(upcoming_signal_in_usecs))) {
-                return false;
+    // see if upcoming signal fits to next CCR increment - if so try to set timer compare value
+    if (fire_time - channel->_current_time_last_stable <= channel->_handle->_timer_overflow_us_increment) {
+        // if upcoming event too close
+        if ( ! _timer_increment_compare_value(channel->_handle,
+                _usecs_to_ticks(channel->_handle, (uint32_t) (fire_time - channel->_current_time_last_stable)))) {
+            // upcoming event is too close, timer was set to next stable value
+            if (interrupt_signal_first) {
+                // pending timer interrupt, signal is handled within interrupt service once interrupts are enabled
+                vector_trigger(channel->_handle);
             }
-
-            if (trigger_upcoming_queue_handler) {
-                action_trigger(&_upcoming_queue_handler, NULL);
+            else {
+                action_trigger(&channel->_upcoming_queue_handler, NULL);
             }
-
-            return true;    // upcoming event is too close, timer was set to next stable value
         }
+
+        return;
     }
 
-    uint32_t timer_next_stable_value = (_timing_handle->_timer_counter_last_stable
-            + _timing_handle->_timer_overflow_ticks_increment) & _timing_handle->_timer_counter_mask;
+    uint32_t timer_next_stable_value = (channel->_handle->_timer_counter_last_stable
+            + channel->_handle->_timer_overflow_ticks_increment) & channel->_handle->_timer_counter_mask;
 
-    if (timer_channel_get_compare_value(_timing_handle) != timer_next_stable_value) {
+    if (timer_channel_get_compare_value(channel->_handle) != timer_next_stable_value) {
         // just keep time tracking running
-        _timer_increment_compare_value(_timing_handle, _timing_handle->_timer_overflow_ticks_increment);
+        _timer_increment_compare_value(channel->_handle, channel->_handle->_timer_overflow_ticks_increment);
     }
-
-    return false;   // no more upcoming signals to be processed
 }
 
-static void _timing_handle_service() {
+static void _timing_handle_service(Timing_channel_t *channel) {
     // interrupt service routine, assume interrupts are disabled already
 
-    if (action_queue_is_empty(&_upcoming_signal_queue) && action_queue_is_empty(&_unsorted_signal_queue)
-            && ! _track_time_request_cnt) {
+    if (action_queue_is_empty(&channel->_upcoming_signal_queue) && ! channel->_timing_wheel_signal_cnt
+            && action_queue_is_empty(&_unsorted_signal_queue) && action_queue_is_empty(&channel->_interrupt_signal_queue)
+            && ! channel->_track_time_request_cnt) {
         // no more timed signals and no time tracking, timer can be stopped
-        timer_channel_stop(_timing_handle);
+        timer_channel_stop(channel->_handle);
     }
-    else if (action_queue_is_empty(&_upcoming_signal_queue)) {
+    else if (action_queue_is_empty(&channel->_upcoming_signal_queue)) {
         // just keep track of current time, no need to get exact 'now', assert timing is active when this point reached
-        get_current_time(NULL);
+        _get_current_time(channel, NULL);
+
+        // timing wheel might have moved some signals to upcoming signal queue
+        if ( ! action_queue_is_empty(&channel->_upcoming_signal_queue) || ! action_queue_is_empty(&channel->_interrupt_signal_queue)) {
+            _check_upcoming_signal_queue(channel, true);
+        }
     }
     else {
-        _check_upcoming_signal_queue(true);
+        _check_upcoming_signal_queue(channel, true);
     }
 }
 
@@ -346,154 +931,267 @@ static void _timing_handle_service() {
  * executed once per each insert to _unsorted_signal_queue with priority inherited from _unsorted_signal_queue.head
  */
 static bool _unsorted_queue_handle() {
-    Timed_signal_t *head, *current;
+    Timed_signal_t *head;
 
     interrupt_suspend();
 
-    if (head = timed_signal(action_queue_pop(&_unsorted_signal_queue))) {
+    // O(1) unless signal belongs to upcoming signal queue, see whether upcoming signal handler should be triggered then
+    if ((head = timed_signal(action_queue_pop(&_unsorted_signal_queue))) && _timing_wheel_insert(head->_channel, head)) {
+        _check_upcoming_signal_queue(head->_channel, false);
+    }
+
+    interrupt_restore();
 
-        current = timed_signal(action_queue_head(&_upcoming_signal_queue));
+    return true;
+}
 
-        if ( ! current || timed_signal_trigger_time(current)->hrs > timed_signal_trigger_time(head)->hrs
-             || (timed_signal_trigger_time(current)->hrs == timed_signal_trigger_time(head)->hrs
-                 && timed_signal_trigger_time(current)->usecs >= timed_signal_trigger_time(head)->usecs)) {
+/**
+ * executed if upcoming queue handler signal of given channel was triggered within _check_upcoming_signal_queue,
+ * execution priority is static (__TIMING_QUEUE_HANDLER_PRIORITY__)
+ *  - all due signals are detached at once against single current time snapshot, timer compare value is set
+ * just once before they are triggered
+ */
+static bool _upcoming_queue_handle(Timing_channel_t *channel) {
+    // static - stack usage optimization
+    static uint64_t current_time, fire_time;
+    // expired signals on their way to execution context, signals released from here meanwhile are just skipped
+    Action_queue_t expired;
+    Timed_signal_t *signal;
 
-            // queue empty or closest upcoming signal
-            deque_insert_first(deque(&_upcoming_signal_queue), deque_item(head));
+    action_queue_create(&expired, false);
 
-            // see whether upcoming signal handler should be triggered
-            _check_upcoming_signal_queue(true);
-        }
-        else if (timed_signal_trigger_time(deque_item_prev(current))->hrs < timed_signal_trigger_time(head)->hrs
-                 || (timed_signal_trigger_time(deque_item_prev(current))->hrs == timed_signal_trigger_time(head)->hrs
-                     && timed_signal_trigger_time(deque_item_prev(current))->usecs <= timed_signal_trigger_time(head)->usecs)) {
+    interrupt_suspend();
 
-            // farthermost upcoming signal
-            deque_insert_last(deque(&_upcoming_signal_queue), deque_item(head));
-        }
-        else {
-            current = timed_signal(deque_item_next(action_queue_head(&_upcoming_signal_queue)));
+    // timing might have been stopped by reinit
+    if ( ! action_queue_is_empty(&channel->_upcoming_signal_queue) && _get_current_time(channel, &current_time)) {
+        fire_time = _upcoming_signal_queue_fire_time(channel);
 
-            // place before first signal that is going to be triggered
-            while ((timed_signal_trigger_time(current)->hrs < timed_signal_trigger_time(head)->hrs
-                    || timed_signal_trigger_time(current)->hrs <= timed_signal_trigger_time(head)->hrs
-                       && timed_signal_trigger_time(current)->usecs < timed_signal_trigger_time(head)->usecs)
-                   && deque_item_next(current) != deque_item(action_queue_head(&_upcoming_signal_queue))) {
+        // upcoming signal queue is sorted by trigger time, O(k) with respect to expired signals
+        while ((signal = timed_signal(action_queue_head(&channel->_upcoming_signal_queue)))
+                && timed_signal_trigger_usecs(signal) <= current_time) {
 
-                current = timed_signal(deque_item_next(current));
+            // signal deferred within it's slack, last one with given trigger time would need interrupt of it's own
+            if (timed_signal_trigger_usecs(signal) < fire_time
+                    && timed_signal_trigger_usecs(signal) != timed_signal_trigger_usecs(deque_item_next(signal))) {
+                _coalesced_interrupt_cnt++;
             }
 
-            deque_insert_before(deque_item(head), deque_item(current));
+#ifdef __TIMING_STATISTICS_ENABLE__
+            _timed_signal_lateness_record(signal, current_time, false);
+#endif
+            // no release hook, nothing to be done on leaving upcoming signal queue
+            deque_insert_last(deque(&expired), deque_item(signal));
         }
     }
 
+    // set timer compare value for the rest
+    if ( ! action_queue_is_empty(&channel->_upcoming_signal_queue) || ! action_queue_is_empty(&channel->_interrupt_signal_queue)) {
+        _check_upcoming_signal_queue(channel, false);
+    }
+
     interrupt_restore();
 
+    do {
+        interrupt_suspend();
+
+        if ((signal = timed_signal(action_queue_pop(&expired)))) {
+            // create time tracking request if signal is periodic
+            if (signal->_periodic) {
+                channel->_track_time_request_cnt++;
+            }
+
+            action_trigger(signal, TIMING_SIGNAL_TIMEOUT);
+        }
+
+        interrupt_restore();
+    }
+    while (signal);
+
     return true;
 }
 
-static void _hours_overflow_adjust(Action_queue_t *queue) {
-    // interrupts are disabled already
-    Timed_signal_t *current;
+// -------------------------------------------------------------------------------------
 
-    if (action_queue_is_empty(queue)) {
-        return;
-    }
+static signal_t _set_periodic(Timed_signal_t *_this, bool periodic) {
 
-    current = timed_signal(action_queue_head(queue));
+    // periodic interrupt context signal must have period
+    if (periodic && _this->_interrupt_context && _time_unit_is_zero(timed_signal_delay(_this))) {
+        return TIMING_INVALID_ARGUMENT;
+    }
 
-    while (true) {
-        timed_signal_trigger_time(current)->hrs &= ~0x8000;
+    interrupt_suspend();
 
-        if ((current = timed_signal(deque_item_next(current))) == timed_signal(action_queue_head(queue))) {
-            break;
+    if (periodic != _this->_periodic) {
+        // periodic state change affects time tracking state if signal was triggered and handler was not yet processed
+        if (action_queue(deque_item_container(_this)) == &action_signal_execution_context(_this)->pending_signal_queue) {
+            // create / remove time tracking request
+            _set_track_time(_this->_channel, periodic);
         }
+
+        _this->_periodic = periodic;
     }
+
+    interrupt_restore();
+
+    return TIMING_SUCCESS;
 }
 
 /**
- * executed if _upcoming_queue_handler signal was triggered within _check_upcoming_signal_queue,
- * execution priority is static (__TIMING_QUEUE_HANDLER_PRIORITY__)
+ * Place unlinked signal to it's channel right away if it takes O(1) - to timing wheel or to either end of upcoming
+ * signal queue, return false if sorted insert in between is required (left to _unsorted_queue_handle())
  */
-static bool _upcoming_queue_handle() {
-    bool upcoming_events_pending = true;
-
-    while (upcoming_events_pending) {
+static bool _timed_signal_inline_insert(Timed_signal_t *signal) {
+    // interrupts are disabled already
 
-        interrupt_suspend();
+    Timing_channel_t *channel = signal->_channel;
+    Timed_signal_t *head = timed_signal(action_queue_head(&channel->_upcoming_signal_queue));
 
-        // mo more than one check with disabled interrupts
-        upcoming_events_pending =  ! action_queue_is_empty(&_upcoming_signal_queue) && _check_upcoming_signal_queue(false);
+    if (timed_signal_trigger_usecs(signal) < channel->_timing_wheel_time && head
+            && timed_signal_trigger_usecs(signal) >= timed_signal_trigger_usecs(head)
+            && timed_signal_trigger_usecs(signal) < timed_signal_trigger_usecs(deque_item_prev(head))) {
 
-        interrupt_restore();
+        return false;
     }
 
-    interrupt_suspend();
-
-    // check whether stable time reached half of total range
-    if (_current_time_last_stable.hrs & 0x8000) {
-        _current_time_last_stable.hrs &= ~0x8000;
-        // ... if so then trigger_time of all scheduled timed signals has to be also adjusted
-        _hours_overflow_adjust(&_upcoming_signal_queue);
-        _hours_overflow_adjust(&_unsorted_signal_queue);
+    if (_timing_wheel_insert(channel, signal)) {
+        _check_upcoming_signal_queue(channel, false);
     }
 
-    interrupt_restore();
+    // no context switch to timing queue processor
+    _avoided_switch_cnt++;
 
     return true;
 }
 
-// -------------------------------------------------------------------------------------
+/**
+ * Channel with the coarsest resolution not exceeding slack of given signal, the finest channel if there is no such
+ */
+static Timing_channel_t *_timing_channel_of(Timed_signal_t *signal) {
+    Timing_channel_t *result = _default_channel, *channel;
+    // slack does not apply to interrupt context signals
+    uint32_t slack = signal->_interrupt_context ? 0 : signal->slack;
+
+    for (channel = _timing_channels + 1; channel < _timing_channels + __TIMING_CHANNEL_CNT__; channel++) {
+        if ( ! channel->_handle) {
+            continue;
+        }
 
-static signal_t _set_periodic(Timed_signal_t *_this, bool periodic) {
+        if (channel->_resolution <= slack ? result->_resolution > slack || channel->_resolution > result->_resolution
+                : result->_resolution > slack && channel->_resolution < result->_resolution) {
+            result = channel;
+        }
+    }
 
-    interrupt_suspend();
+    return result;
+}
 
-    if (periodic != _this->_periodic) {
-        // periodic state change affects time tracking state if signal was triggered and handler was not yet processed
-        if (action_queue(deque_item_container(_this)) == &action_signal_execution_context(_this)->pending_signal_queue) {
-            // create / remove time tracking request
-            set_track_current_time(periodic);
+/**
+ * Schedule signal to be triggered after it's delay or at given absolute deadline (time of default channel),
+ * signal that is not interrupt context signal is triggered right away if deadline is history and trigger_expired set
+ */
+static signal_t _schedule_to(Timed_signal_t *_this, Time_unit_t *deadline, bool trigger_expired) {
+    // interrupts are disabled already
+
+    Timing_channel_t *channel;
+    uint64_t current_time = 0, default_time = 0, deadline_time;
+
+    if (deadline && ! _get_current_time(_default_channel, &default_time)) {
+        // absolute time is not valid since timing stopped
+        return TIMING_INVALID_STATE;
+    }
+
+    // leave previous channel (remove time tracking request if periodic, in _on_timed_signal_released hook)
+    action_release(_this);
+
+    // route by current slack
+    channel = _this->_channel = _timing_channel_of(_this);
+
+    if (deadline && channel == _default_channel) {
+        current_time = default_time;
+    }
+    else if ( ! _get_current_time(channel, &current_time)) {
+        // start timing, current time is zero
+        _timing_restart(channel);
+    }
+
+    if ( ! deadline) {
+        timed_signal_trigger_usecs(_this) = current_time + _time_unit_to_usecs(timed_signal_delay(_this));
+    }
+    else if ((deadline_time = _time_unit_to_usecs(deadline)) > default_time) {
+        // deadline in time of given channel
+        timed_signal_trigger_usecs(_this) = current_time + (deadline_time - default_time);
+    }
+    else {
+        // deadline is history, but not before timing start of given channel
+        timed_signal_trigger_usecs(_this) = default_time - deadline_time < current_time
+                ? current_time - (default_time - deadline_time) : 0;
+
+        if ( ! _this->_interrupt_context) {
+            if ( ! trigger_expired) {
+                return TIMING_SIGNAL_TIMEOUT;
+            }
+
+            // trigger right away without timing queue insert, create time tracking request if signal is periodic
+            if (_this->_periodic) {
+                channel->_track_time_request_cnt++;
+            }
+
+            action_trigger(_this, TIMING_SIGNAL_TIMEOUT);
+
+            return TIMING_SIGNAL_TIMEOUT;
         }
+    }
 
-        _this->_periodic = periodic;
+    if (_this->_interrupt_context) {
+        // no signal processor involved, sorted insert right away, O(n) with respect to interrupt context signals
+        if (_timed_signal_queue_insert(&channel->_interrupt_signal_queue, _this)) {
+            _check_upcoming_signal_queue(channel, false);
+        }
+
+        return TIMING_SUCCESS;
     }
 
-    interrupt_restore();
+    // bounded insert within critical section of the caller, otherwise insert to unsorted queue to be placed
+    // to channel within _unsorted_queue_handle()
+    if ( ! _timed_signal_inline_insert(_this)) {
+        action_queue_insert(&_unsorted_signal_queue, _this);
+        action_trigger(&_unsorted_queue_handler, NULL);
+    }
 
     return TIMING_SUCCESS;
 }
 
-static signal_t _schedule(Timed_signal_t *_this) {
+static signal_t _schedule_deadline(Timed_signal_t *_this, Time_unit_t *deadline, bool trigger_expired) {
+    signal_t result;
 
     // sanity check
-    if ( ! _timing_handle) {
+    if ( ! _default_channel->_handle) {
         return TIMING_INVALID_STATE;
     }
+    // zero period of interrupt context signal would keep it within interrupt service
+    else if (_this->_periodic && _this->_interrupt_context && _time_unit_is_zero(timed_signal_delay(_this))) {
+        return TIMING_INVALID_ARGUMENT;
+    }
 
     interrupt_suspend();
 
-    if ( ! timer_channel_is_active(_timing_handle)) {
-        // start timing,
-        _timing_restart();
-        // reset trigger time in case signal reused
-        time_unit_reset(timed_signal_trigger_time(_this));
-    }
-    else {
-        // make trigger time match current time
-        get_current_time(timed_signal_trigger_time(_this));
-    }
+    result = _schedule_to(_this, deadline, trigger_expired);
 
-    timed_signal_trigger_time(_this)->hrs += timed_signal_delay(_this)->hrs;
-    _time_unit_add_usecs(timed_signal_trigger_time(_this), timed_signal_delay(_this)->usecs);
+    interrupt_restore();
+
+    return result;
+}
 
-    // insert to unsorted queue, also remove time tracking request if periodic (in _on_timed_signal_released hook)
-    action_queue_insert(&_unsorted_signal_queue, _this);
-    action_trigger(&_unsorted_queue_handler, NULL);
+static signal_t _schedule_at(Timed_signal_t *_this, Time_unit_t *deadline) {
+    return _schedule_deadline(_this, deadline, true);
+}
 
-    interrupt_restore();
+static signal_t _schedule(Timed_signal_t *_this) {
+    return _schedule_deadline(_this, NULL, true);
+}
 
-    return TIMING_SUCCESS;
+signal_t timed_signal_schedule_deadline(Timed_signal_t *signal, Time_unit_t *deadline) {
+    return _schedule_deadline(signal, deadline, false);
 }
 
 // -------------------------------------------------------------------------------------
@@ -501,12 +1199,21 @@ static signal_t _schedule(Timed_signal_t *_this) {
 static void _on_timed_signal_released(Timed_signal_t *_this, Action_queue_t *origin) {
     // interrupts are disabled already
 
+    Timing_channel_t *channel = _this->_channel;
+
+    if (_is_timing_wheel_slot(channel, origin)) {
+        // canceled while in timing wheel
+        channel->_timing_wheel_signal_cnt--;
+
+        return;
+    }
+
     if ( ! _this->_periodic || origin != &action_signal_execution_context(_this)->pending_signal_queue) {
         return;
     }
 
     // periodic signal was released from target context, it no longer needs time tracking
-    _track_time_request_cnt--;
+    channel->_track_time_request_cnt--;
 }
 
 static bool _on_timed_signal_handled(Timed_signal_t *_this) {
@@ -517,18 +1224,16 @@ static bool _on_timed_signal_handled(Timed_signal_t *_this) {
     }
 
     // update signal trigger time
-    timed_signal_trigger_time(_this)->hrs += timed_signal_delay(_this)->hrs;
-    _time_unit_add_usecs(timed_signal_trigger_time(_this), timed_signal_delay(_this)->usecs);
+    _periodic_trigger_time_update(_this);
 
-    // current time overflow check
-    if (timed_signal_trigger_time(_this)->hrs & 0x8000
-            && timed_signal_trigger_time(_this)->hrs - _current_time_last_stable.hrs > MAX_DELAY_HRS) {
-        timed_signal_trigger_time(_this)->hrs &= ~0x8000;
-    }
+    // remove time tracking request (in _on_timed_signal_released hook)
+    action_release(_this);
 
-    // reinsert to unsorted queue, also remove time tracking request if periodic (in _on_timed_signal_released hook)
-    action_queue_insert(&_unsorted_signal_queue, _this);
-    action_trigger(&_unsorted_queue_handler, NULL);
+    // reinsert to channel right away if bounded, to unsorted queue otherwise
+    if ( ! _timed_signal_inline_insert(_this)) {
+        action_queue_insert(&_unsorted_signal_queue, _this);
+        action_trigger(&_unsorted_queue_handler, NULL);
+    }
 
     return true;
 }
@@ -537,6 +1242,7 @@ static bool _on_timed_signal_handled(Timed_signal_t *_this) {
 static dispose_function_t _timed_signal_dispose(Timed_signal_t *_this) {
 
     _this->schedule = (signal_t (*)(Timed_signal_t *)) unsupported_after_disposed;
+    _this->schedule_at = (signal_t (*)(Timed_signal_t *, Time_unit_t *)) unsupported_after_disposed;
     _this->set_periodic = (signal_t (*)(Timed_signal_t *, bool)) unsupported_after_disposed;
 
     return NULL;
@@ -556,57 +1262,143 @@ void timed_signal_register(Timed_signal_t *signal, signal_handler_t handler, boo
     action_on_released(signal) = (action_released_hook_t) _on_timed_signal_released;
 
     // state
+    time_unit_reset(timed_signal_delay(signal));
     signal->_periodic = periodic;
+    signal->_interrupt_context = false;
+    signal->_channel = _default_channel;
+    signal->_missed_cnt = 0;
+    signal->slack = 0;
+#ifdef __TIMING_STATISTICS_ENABLE__
+    *timed_signal_statistics(signal) = _timing_statistics_empty;
+#endif
 
     // public
     signal->set_periodic = _set_periodic;
     signal->schedule = _schedule;
+    signal->schedule_at = _schedule_at;
+    signal->overrun_policy = TIMED_SIGNAL_OVERRUN_CATCH_UP;
+    signal->on_overrun = NULL;
+}
+
+// Timed_signal_t constructor, interrupt context flavor
+void timed_interrupt_signal_register(Timed_signal_t *signal, signal_handler_t handler, bool periodic) {
+
+    // signal can still be triggered the standard way, running process becomes it's execution context then
+    timed_signal_register(signal, handler, periodic, NULL, running_process);
+
+    signal->_interrupt_context = true;
 }
 
 // -------------------------------------------------------------------------------------
 
+/**
+ * Fixed-point reciprocal of (numerator / denominator) - multiplier and shift such that the multiplier is
+ * ceil(numerator * 2^shift / denominator) with the highest precision that fits 32 bits, shift <= 32
+ *  - executed once on timing reinit, conversions do not divide anymore
+ */
+static uint8_t _reciprocal_of(uint32_t numerator, uint32_t denominator, uint32_t *multiplier) {
+    uint64_t result;
+    uint8_t shift = 32;
+
+    while ((result = ((((uint64_t) numerator) << shift) + denominator - 1) / denominator) > UINT32_MAX) {
+        shift--;
+    }
+
+    *multiplier = (uint32_t) result;
+
+    return shift;
+}
+
+static uint8_t _timing_wheel_slot_shift_of(Timing_handle_t *handle) {
+    uint8_t shift = 0;
+
+    // largest power of 2 not exceeding overflow increment
+    while (((uint32_t) 2 << shift) <= handle->_timer_overflow_us_increment) {
+        shift++;
+    }
+
+    return shift;
+}
+
 signal_t timing_reinit(Timing_handle_t *handle, Process_control_block_t *timing_queue_processor, bool persistent_state_reset) {
+    Timing_channel_t *channel;
+    uint8_t level;
+    uint16_t index;
 
     // sanity check
     if ( ! handle) {
         return TIMING_HANDLE_EMPTY;
     }
-    else if (handle->timer_counter_bit_width < 8 || handle->timer_counter_bit_width > 32) {
+    else if (handle->timer_counter_bit_width < 8 || handle->timer_counter_bit_width > 32
+            || handle->timing_channel >= __TIMING_CHANNEL_CNT__) {
+
         return TIMING_HANDLE_UNSUPPORTED;
     }
 
-    // try register handle interrupt service handler
+    channel = &_timing_channels[handle->timing_channel];
+
+    // try register handle interrupt service handler, the channel is passed to it
     if (timer_channel_stop(handle) || vector_clear_interrupt_flag(handle) || vector_set_enabled(handle, true)
-            || vector_register_handler(handle, _timing_handle_service, NULL, NULL) == NULL) {
+            || vector_register_handler(handle, _timing_handle_service, channel, NULL) == NULL) {
 
         return TIMING_HANDLE_UNSUPPORTED;
     }
 
-    if (_timing_handle && persistent_state_reset) {
-        timer_channel_stop(_timing_handle);
+    if (channel->_handle && persistent_state_reset) {
+        timer_channel_stop(channel->_handle);
     }
 
     // first time initialization / reset
     if (persistent_state_reset) {
-        // unsorted queue handler
-        action_signal_create(&_unsorted_queue_handler, NULL, _unsorted_queue_handle, NULL, timing_queue_processor);
-        // priority of unsorted queue handler is inherited only from unsorted queue head (not from actual running process)
-        sorted_set_item_priority(&_unsorted_queue_handler) = 0;
-        // upcoming signal queue handler
-        action_signal_create(&_upcoming_queue_handler, NULL, _upcoming_queue_handle, NULL, timing_queue_processor);
+        // state shared by all channels is reset with default channel
+        if (channel == _default_channel) {
+            // unsorted queue handler
+            action_signal_create(&_unsorted_queue_handler, NULL, _unsorted_queue_handle, NULL, timing_queue_processor);
+            // priority of unsorted queue handler is inherited only from unsorted queue head (not from actual running process)
+            sorted_set_item_priority(&_unsorted_queue_handler) = 0;
+            // unsorted_queue_handler - inherit priority of unsorted_signal_queue
+            action_queue_create(&_unsorted_signal_queue, true, false, &_unsorted_queue_handler, action_default_set_priority);
+            _coalesced_interrupt_cnt = 0;
+            _avoided_switch_cnt = 0;
+#ifdef __TIMING_STATISTICS_ENABLE__
+            _timing_statistics = _timing_statistics_empty;
+#endif
+        }
+
+        // upcoming signal queue handler, executed with channel as owner
+        action_signal_create(&channel->_upcoming_queue_handler, NULL, _upcoming_queue_handle, NULL, timing_queue_processor);
+        action_owner(&channel->_upcoming_queue_handler) = channel;
         // priority of upcoming queue handler is static (not inherited from actual running process)
-        sorted_set_item_priority(&_upcoming_queue_handler) = __TIMING_QUEUE_HANDLER_PRIORITY__;
-        // unsorted_queue_handler - inherit priority of unsorted_signal_queue
-        action_queue_create(&_unsorted_signal_queue, true, false, &_unsorted_queue_handler, action_default_set_priority);
+        sorted_set_item_priority(&channel->_upcoming_queue_handler) = __TIMING_QUEUE_HANDLER_PRIORITY__;
         // upcoming signals
-        action_queue_create(&_upcoming_signal_queue, false);
+        action_queue_create(&channel->_upcoming_signal_queue, false);
+        // interrupt context signals
+        action_queue_create(&channel->_interrupt_signal_queue, false);
+        // timing wheel slots
+        for (level = 0; level < __TIMING_WHEEL_LEVELS__; level++) {
+            for (index = 0; index < _WHEEL_SLOTS; index++) {
+                action_queue_create(_timing_wheel_slot(channel, level, index), false);
+            }
+        }
+        channel->_timing_wheel_signal_cnt = 0;
         // no tracking time on reset, no periodic signals active
-        _track_time_request_cnt = 0;
+        channel->_track_time_request_cnt = 0;
     }
 
-    // default if timer clocked by 1MHz -> 1 tick == 1 us
     if ( ! handle->ticks_to_usecs || ! handle->usecs_to_ticks) {
-        handle->ticks_to_usecs = handle->usecs_to_ticks = _no_conversion;
+        handle->ticks_to_usecs = handle->usecs_to_ticks = NULL;
+
+        if (handle->timer_frequency_hz) {
+            // generate reciprocal conversion from timer frequency
+            handle->_ticks_to_usecs_shift = _reciprocal_of(SECOND_MICROSECONDS, handle->timer_frequency_hz,
+                    &handle->_ticks_to_usecs_multiplier);
+            handle->_usecs_to_ticks_shift = _reciprocal_of(handle->timer_frequency_hz, SECOND_MICROSECONDS,
+                    &handle->_usecs_to_ticks_multiplier);
+        }
+        else {
+            // default if timer clocked by 1MHz -> 1 tick == 1 us
+            handle->ticks_to_usecs = handle->usecs_to_ticks = _no_conversion;
+        }
     }
 
     handle->_timer_counter_mask = UINT32_MAX;
@@ -631,14 +1423,14 @@ signal_t timing_reinit(Timing_handle_t *handle, Process_control_block_t *timing_
           0xF0 << (handle->timer_counter_bit_width - 8));
 
     // there should be no error (remainder) in this conversion - if not then expect this error on each timer register increment
-    handle->_timer_overflow_us_increment = handle->ticks_to_usecs(handle->_timer_overflow_ticks_increment);
+    handle->_timer_overflow_us_increment = _ticks_to_usecs(handle, handle->_timer_overflow_ticks_increment);
 
     // if 1 tick is more that 1 us (_timer_overflow_us_increment overflow check)
-    if (handle->ticks_to_usecs(0x2A30) > 0x2A30) {
+    if (_ticks_to_usecs(handle, 0x2A30) > 0x2A30) {
         uint32_t timer_overflow_ticks_max;
 
         // actual maximum of _timer_overflow_us_increment larger than absolute maximum
-        if (handle->_timer_overflow_ticks_increment > (timer_overflow_ticks_max = handle->usecs_to_ticks(HOUR_MICROSECONDS))) {
+        if (handle->_timer_overflow_ticks_increment > (timer_overflow_ticks_max = _usecs_to_ticks(handle, HOUR_MICROSECONDS))) {
             // HOUR_MICROSECONDS is divisible by 5^8, 3^2 and 2^10, therefore the conversion error should not be too bad
             handle->_timer_overflow_ticks_increment = timer_overflow_ticks_max;
             // ... and the absolute error is added to current time just once per hour
@@ -678,28 +1470,50 @@ signal_t timing_reinit(Timing_handle_t *handle, Process_control_block_t *timing_
         handle->_timer_compare_value_set_threshold = 1;
     }
 
-    if ( ! persistent_state_reset && _timing_handle && timer_channel_is_active(_timing_handle)) {
+#ifndef __TIMING_BUSY_WAIT_DISABLE__
+    // delay that is too short to be set as timer compare value is always busy-waited
+    if ((handle->_busy_wait_threshold = _ticks_to_usecs(handle, handle->_timer_compare_value_set_threshold))
+            < __TIMING_BUSY_WAIT_THRESHOLD__) {
+        handle->_busy_wait_threshold = __TIMING_BUSY_WAIT_THRESHOLD__;
+    }
+#endif
+
+    // duration of single tick, no less than 1 usec
+    if ( ! (channel->_resolution = _ticks_to_usecs(handle, 1))) {
+        channel->_resolution = 1;
+    }
+
+    if ( ! persistent_state_reset && channel->_handle && timer_channel_is_active(channel->_handle)) {
         // start new handle...
         timer_channel_start(handle);
         // ...and store it's counter content
         timer_channel_get_counter(handle, &handle->_timer_counter_last_stable);
         // sync &handle->_timer_counter_last_stable and &_current_time_last_stable
-        get_current_time(&_current_time_last_stable);
+        _get_current_time(channel, &channel->_current_time_last_stable);
         // stop previous handle
-        timer_channel_stop(_timing_handle);
+        timer_channel_stop(channel->_handle);
         // set next interrupt in next static increment
         timer_channel_set_compare_value(handle, (handle->_timer_counter_last_stable
                 + handle->_timer_overflow_ticks_increment) & handle->_timer_counter_mask);
         // clear interrupt in case triggered within this function
         vector_clear_interrupt_flag(handle);
 
+        channel->_handle = handle;
+        // place timed signals according to slot width of new handle
+        channel->_timing_wheel_slot_shift = _timing_wheel_slot_shift_of(handle);
+        _timing_wheel_rebuild(channel);
+
         // let upcoming queue handler set proper next timer compare value
-        if ( ! action_queue_is_empty(&_upcoming_signal_queue)) {
-            action_trigger(&_upcoming_queue_handler, NULL);
+        if ( ! action_queue_is_empty(&channel->_upcoming_signal_queue)) {
+            action_trigger(&channel->_upcoming_queue_handler, NULL);
+        }
+        else if ( ! action_queue_is_empty(&channel->_interrupt_signal_queue)) {
+            _check_upcoming_signal_queue(channel, false);
         }
     }
 
-    _timing_handle = handle;
+    channel->_handle = handle;
+    channel->_timing_wheel_slot_shift = _timing_wheel_slot_shift_of(handle);
 
     // handle API return values ignored from now on, assume handle is not disposed
 
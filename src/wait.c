@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2018-2019 Mutant Industries ltd.
+#include <wait.h>
+#include <stddef.h>
+#include <driver/interrupt.h>
+#include <event.h>
+#include <process.h>
+#include <sync/semaphore.h>
+
+
+/**
+ * State of single wait_multiple() call, kept on stack of waiting process
+ */
+struct Wait_multiple {
+    // process to be woken up when wait completes
+    Process_control_block_t *process;
+    // number of nodes yet to fire to complete the wait
+    uint8_t remaining_cnt;
+    // node that completed the wait
+    uint8_t completed_index;
+};
+
+// -------------------------------------------------------------------------------------
+
+static void _wait_node_fire(Wait_node_t *_this, signal_t signal) {
+    // interrupts are disabled already
+    struct Wait_multiple *waiter = _this->_waiter;
+
+    _this->_fired = true;
+    _this->_signal = signal;
+
+    // object shall not trigger this node again
+    action_release(_this);
+
+    if (waiter->remaining_cnt && ! --waiter->remaining_cnt) {
+        waiter->completed_index = _this->_index;
+        // single wakeup, schedule_handler() ignores process that is not suspended yet
+        action_trigger(waiter->process, signal);
+    }
+}
+
+static void _wait_node_trigger(Wait_node_t *_this, signal_t signal) {
+
+    interrupt_suspend();
+
+    if ( ! _this->_waiter) {
+        // semaphore picked this node before the wait ended, pass the permit on
+        if (_this->_type == WAIT_NODE_SEMAPHORE && signal != SEMAPHORE_DISPOSED) {
+            semaphore_signal(_this->_object, signal);
+        }
+    }
+    else if ( ! _this->_fired) {
+        _wait_node_fire(_this, signal);
+    }
+
+    interrupt_restore();
+}
+
+static void _wait_node_arm(Wait_node_t *_this) {
+    // interrupts are disabled already
+    signal_t result;
+
+    switch (_this->_type) {
+        case WAIT_NODE_EVENT:
+            if ((result = event_subscribe(_this->_object, _this)) != EVENT_SUCCESS) {
+                _wait_node_fire(_this, result);
+            }
+            break;
+        case WAIT_NODE_SEMAPHORE:
+            // acquire right away if possible, enqueue otherwise
+            if ((result = semaphore_try_acquire(_this->_object)) != SEMAPHORE_NO_PERMITS
+                    || (result = semaphore_acquire_async(_this->_object, _this)) != SEMAPHORE_SUCCESS) {
+                _wait_node_fire(_this, result);
+            }
+            break;
+        case WAIT_NODE_PROCESS:
+            if ( ! process_wait_for_async(process(_this->_object), action(_this))) {
+                _wait_node_fire(_this, PROCESS_SIGNAL_EXIT);
+            }
+            break;
+    }
+}
+
+static void _wait_node_disarm(Wait_node_t *_this, bool keep_permit) {
+    // interrupts are disabled already
+
+    action_release(_this);
+
+    _this->_waiter = NULL;
+
+    // return permit acquired by node that did not complete the wait
+    if (_this->_fired && _this->_type == WAIT_NODE_SEMAPHORE && ! keep_permit && _this->_signal != SEMAPHORE_DISPOSED) {
+        semaphore_signal(_this->_object, SEMAPHORE_SUCCESS);
+
+        _this->_fired = false;
+    }
+}
+
+// -------------------------------------------------------------------------------------
+
+signal_t wait_multiple(Wait_node_t *nodes, uint8_t cnt, bool wait_all, Time_unit_t *timeout, Schedule_config_t *with_config) {
+    struct Wait_multiple waiter;
+    signal_t result;
+    uint8_t i;
+
+    // sanity check
+    if ( ! cnt) {
+        return WAIT_INVALID_ARGUMENT;
+    }
+
+    for (i = 0; i < cnt; i++) {
+        if (nodes[i]._type != WAIT_NODE_EVENT && nodes[i]._type != WAIT_NODE_SEMAPHORE && nodes[i]._type != WAIT_NODE_PROCESS) {
+            return WAIT_INVALID_ARGUMENT;
+        }
+    }
+
+    waiter.process = running_process;
+    waiter.remaining_cnt = wait_all ? cnt : 1;
+
+    // store / reset schedule config, nodes inherit resulting priority
+    schedule_config_copy(with_config, process_schedule_config(running_process));
+    schedulable_state_reset(running_process, NULL);
+
+    interrupt_suspend();
+
+    for (i = 0; i < cnt; i++) {
+        nodes[i]._waiter = &waiter;
+        nodes[i]._index = i;
+        nodes[i]._fired = false;
+        nodes[i]._signal = NULL;
+        sorted_set_item_priority(&nodes[i]) = sorted_set_item_priority(running_process);
+    }
+
+    // no need to link the rest once completed (some nodes may fire right away)
+    for (i = 0; i < cnt && waiter.remaining_cnt; i++) {
+        _wait_node_arm(&nodes[i]);
+    }
+
+    // suspend just once unless completed already, single wakeup by completing node or by timeout
+    if (waiter.remaining_cnt) {
+        suspend(WAIT_TIMEOUT, NULL, timeout, with_config);
+    }
+
+    interrupt_restore();
+
+    // process resumed here, wait is completed or timed out
+    interrupt_suspend();
+
+    result = waiter.remaining_cnt ? WAIT_TIMEOUT : signal((intptr_t) waiter.completed_index);
+
+    for (i = 0; i < cnt; i++) {
+        _wait_node_disarm(&nodes[i], ! waiter.remaining_cnt && (wait_all || i == waiter.completed_index));
+    }
+
+    interrupt_restore();
+
+    return result;
+}
+
+// -------------------------------------------------------------------------------------
+
+// Wait_node_t constructor
+void wait_node_register(Wait_node_t *node, uint8_t type, void *object) {
+
+    action_create(node, NULL, _wait_node_trigger);
+
+    node->_object = object;
+    node->_type = type;
+
+    // state
+    node->_waiter = NULL;
+    node->_fired = false;
+    node->_signal = NULL;
+}